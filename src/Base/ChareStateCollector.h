@@ -36,6 +36,12 @@ class ChareStateCollector : public CBase_ChareStateCollector {
     //! Constructor
     //! \details Start timer when constructor is called
     explicit ChareStateCollector() : m_state(), m_timer() {}
+    //! Migrate constructor
+    //! \details Called only when restarting from a checkpoint. The timer is
+    //!   restarted, thus time stamps after a restart are relative to the
+    //!   restart.
+    explicit ChareStateCollector( CkMigrateMessage* m ) :
+      CBase_ChareStateCollector( m ), m_state(), m_timer() {}
     #if defined(__clang__)
       #pragma clang diagnostic pop
     #endif
@@ -50,6 +56,17 @@ class ChareStateCollector : public CBase_ChareStateCollector {
     //! Collect chare state
     void collect( bool error, CkCallback cb );
 
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) override { p | m_state; }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c ChareStateCollector object reference
+    friend void operator|( PUP::er& p, ChareStateCollector& c ) { c.pup(p); }
+    //@}
+
   private:
     std::vector< ChareState > m_state;  //!< Chare states
     Timer m_timer;                      //!< Timer for getting time stamps
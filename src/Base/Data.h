@@ -669,6 +669,49 @@ maxdiff( const Data< Layout >& lhs, const Data< Layout >& rhs ) {
   return m;
 }
 
+//! Fused element-wise kernel over raw data of a number of Data objects
+//! \param[in] n Number of raw data items
+//! \param[in,out] r Raw data to write the result to
+//! \param[in] op Function to apply to the items of all operands
+//! \param[in] d Raw data of the operands
+//! \details The loop is the only pass over memory, thus r may alias any of
+//!   the operands.
+template< class Op, class... Ptr >
+void fusekernel( std::size_t n, tk::real* r, const Op& op, const Ptr*... d ) {
+  for (std::size_t i=0; i<n; ++i) r[i] = op( d[i]... );
+}
+
+//! Evaluate an element-wise expression of Data objects into a Data object
+//! \param[in,out] r Data object to store the result in
+//! \param[in] op Function taking one tk::real for each operand and returning
+//!   the result as a tk::real
+//! \param[in] d Data objects to use as operands
+//! \details This is the temporary-free alternative to chaining the arithmetic
+//!   operators of Data, e.g., instead of u = a*un + b*(u + dt*rhs/lhs), which
+//!   allocates and traverses a new Data object for each operator, use
+//!   \code{.cpp}
+//!     tk::fuse( u,
+//!       [=]( tk::real u, tk::real un, tk::real rhs, tk::real lhs )
+//!       { return a*un + b*(u + dt*rhs/lhs); },
+//!       u, un, rhs, lhs );
+//!   \endcode
+//!   which performs a single pass over memory without heap allocation. Since
+//!   the items are computed one by one, r may also appear among the operands.
+//!   The result is bitwise identical to that of the equivalent operator
+//!   expression if op evaluates the same arithmetic in the same order.
+//! \note The Data objects _r_ and _d_ must have the same number of unknowns
+//!   and properties.
+template< uint8_t Layout, class Op, class... Ds >
+void fuse( Data< Layout >& r, const Op& op, const Ds&... d ) {
+  #ifndef NDEBUG
+  for (auto s : { d.nunk()... })
+    Assert( s == r.nunk(), "Number of unknowns unequal" );
+  for (auto s : { d.nprop()... })
+    Assert( s == r.nprop(), "Number of properties unequal" );
+  #endif
+  fusekernel( r.data().size(), r.data().data(), op, d.data().data()... );
+}
+
 } // tk::
 
 #endif // Data_h
@@ -0,0 +1,168 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/MappedFile.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Memory-mapped file and fast text parsing declarations
+  \details   Memory-mapped file and fast text parsing declarations. MappedFile
+    maps a file read-only into memory so that it can be parsed without
+    buffered stream input. Scanner parses numbers and lines from a range of
+    characters of a mapped file and parseLines() parses large sections of a
+    file, consisting of one record per line, concurrently, in chunks of whole
+    lines.
+*/
+// *****************************************************************************
+#ifndef MappedFile_h
+#define MappedFile_h
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <functional>
+
+#include "Types.h"
+#include "Exception.h"
+
+namespace tk {
+
+//! Read-only memory map of a file
+class MappedFile {
+
+  public:
+    //! Constructor: map file into memory
+    explicit MappedFile( const std::string& filename );
+
+    //! Destructor: unmap file
+    ~MappedFile() noexcept;
+
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile& operator=( const MappedFile& ) = delete;
+
+    //! Beginning of file contents
+    const char* begin() const { return m_data; }
+    //! One past the end of file contents
+    const char* end() const { return m_data + m_size; }
+    //! File size in bytes
+    std::size_t size() const { return m_size; }
+
+  private:
+    const std::string m_filename;       //!< File name
+    const char* m_data;                 //!< Mapped file contents
+    std::size_t m_size;                 //!< File size in bytes
+};
+
+//! Parse numbers, lines, and binary data from a range of characters
+//! \details The range does not have to be zero-terminated, thus it may point
+//!   into a memory-mapped file. Numbers are separated by whitespace, including
+//!   newlines.
+class Scanner {
+
+  public:
+    //! Constructor: start parsing at the beginning of a range of characters
+    //! \param[in] b Beginning of range
+    //! \param[in] e One past the end of range
+    explicit Scanner( const char* b, const char* e ) : m_p( b ), m_end( e ) {}
+
+    //! Current position
+    const char* pos() const { return m_p; }
+    //! Continue parsing at a position
+    //! \param[in] p New position
+    void pos( const char* p ) { m_p = p; }
+
+    //! Skip whitespace and query if the end of range has been reached
+    //! \return True if there is nothing but whitespace left
+    bool done() {
+      while (m_p != m_end && isSpace(*m_p)) ++m_p;
+      return m_p == m_end;
+    }
+
+    //! Parse an unsigned integer
+    std::size_t unsignedInt() {
+      ErrChk( !done() && isDigit(*m_p), "Expected unsigned integer" );
+      std::size_t u = 0;
+      while (m_p != m_end && isDigit(*m_p))
+        u = u*10 + static_cast< std::size_t >( *m_p++ - '0' );
+      return u;
+    }
+
+    //! Parse a signed integer
+    long integer() {
+      bool neg = false;
+      if (!done() && (*m_p == '-' || *m_p == '+')) neg = *m_p++ == '-';
+      const auto u = static_cast< long >( unsignedInt() );
+      return neg ? -u : u;
+    }
+
+    //! Parse a floating-point number
+    tk::real real();
+
+    //! Skip the rest of the current line including the newline
+    void skipLine() {
+      auto n = static_cast< const char* >(
+                 std::memchr( m_p, '\n', static_cast<std::size_t>(m_end-m_p) ) );
+      m_p = n ? n+1 : m_end;
+    }
+
+    //! Return the rest of the current line and skip past the newline
+    //! \return Rest of the current line without the line terminator
+    std::string line() {
+      const auto b = m_p;
+      skipLine();
+      auto e = m_p;
+      while (e != b && (e[-1] == '\n' || e[-1] == '\r')) --e;
+      return std::string( b, e );
+    }
+
+    //! Copy raw bytes, e.g., binary data, and advance past them
+    //! \param[in] dst Destination to copy to
+    //! \param[in] n Number of bytes to copy
+    void read( void* dst, std::size_t n ) {
+      ErrChk( static_cast< std::size_t >( m_end - m_p ) >= n,
+              "Unexpected end of binary data" );
+      std::memcpy( dst, m_p, n );
+      m_p += n;
+    }
+
+  private:
+    const char* m_p;            //!< Current position
+    const char* const m_end;    //!< One past the end of range
+
+    //! Query if character is whitespace
+    static bool isSpace( char c )
+    { return c == ' ' || c == '\n' || c == '\t' || c == '\r'; }
+    //! Query if character is a decimal digit
+    static bool isDigit( char c ) { return c >= '0' && c <= '9'; }
+};
+
+//! Find the first line starting with a string
+const char*
+findLine( const char* b, const char* e, const std::string& s );
+
+//! Skip a number of non-empty lines
+const char*
+skipLines( const char* b, const char* e, std::size_t n );
+
+//! Count non-empty lines
+std::size_t
+countLines( const char* b, const char* e );
+
+//! Split a range of characters into chunks of whole lines
+std::vector< const char* >
+lineChunks( const char* b,
+            const char* e,
+            std::size_t nthread,
+            std::size_t minsize = 1<<20 );
+
+//! Parse chunks of lines concurrently, one record per non-empty line
+std::size_t
+parseLines( const std::vector< const char* >& chunks,
+            std::size_t nthread,
+            const std::function< void( std::size_t, std::size_t,
+                                       const char*, const char* ) >& f );
+
+} // tk::
+
+#endif // MappedFile_h
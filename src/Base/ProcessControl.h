@@ -13,12 +13,16 @@
 #define ProcessControl_h
 
 #include <iosfwd>
+#include <cstddef>
 
 namespace tk {
 
 //! Remove file from file system
 void rm( const std::string& file );
 
+//! Query disk usage of a file or directory in bytes
+std::size_t du( const std::string& path );
+
 } // tk::
 
 #endif // ProcessControl_h
@@ -8,7 +8,10 @@
   \brief     Basic functionality for storing and sampling a discrete y = f(x)
              function
   \details   Basic functionality for storing and sampling a discrete y = f(x)
-             function.
+             function. tk::sample() scans the table linearly and is intended
+             for sampling a table only once in a while, while tk::CompiledTable
+             precomputes the interpolants of a table for sampling it often,
+             e.g., every time step.
 */
 // *****************************************************************************
 #ifndef Table_h
@@ -27,6 +30,49 @@ using Table = std::vector< std::pair< tk::real, tk::real > >;
 //! Sample a discrete y = f(x) function at x
 tk::real sample( tk::real x, const tk::Table& table );
 
+//! \brief Discrete y = f(x) function with precomputed linear interpolants for
+//!   fast sampling
+//! \details The x values of the table are sorted into breakpoints and the
+//!   linear interpolant between each pair of neighboring breakpoints is
+//!   precomputed. If the breakpoints are equally spaced (to within round-off),
+//!   the interval containing an abscissa is found in constant time, otherwise
+//!   by binary search. Sampled values equal those of tk::sample(), also for
+//!   tables whose x column is not increasing everywhere, except exactly at
+//!   the x values of the table.
+class CompiledTable {
+
+  public:
+    //! Empty constructor
+    explicit CompiledTable() :
+      m_x(), m_y(), m_slope(), m_ylo( 0.0 ), m_yhi( 0.0 ),
+      m_uniform( false ), m_rdx( 0.0 ) {}
+
+    //! Constructor: precompute interpolants of table
+    explicit CompiledTable( const tk::Table& table );
+
+    //! Sample function at x
+    tk::real sample( tk::real x ) const;
+
+    //! Sample function at multiple abscissae
+    void sample( const tk::real* x, tk::real* y, std::size_t n ) const;
+
+    //! Query if the breakpoints are equally spaced
+    //! \return True if the interval of an abscissa is found in constant time
+    bool uniform() const noexcept { return m_uniform; }
+
+  private:
+    std::vector< tk::real > m_x;        //!< Breakpoints, increasing
+    std::vector< tk::real > m_y;        //!< Values at left of intervals
+    std::vector< tk::real > m_slope;    //!< Slopes in intervals
+    tk::real m_ylo;                     //!< Value below first breakpoint
+    tk::real m_yhi;                     //!< Value above last breakpoint
+    bool m_uniform;                     //!< True if breakpoints equally spaced
+    tk::real m_rdx;                     //!< 1/spacing if breakpoints uniform
+
+    //! Find interval containing x, first <= x < last breakpoint
+    std::size_t interval( tk::real x ) const;
+};
+
 } // tk::
 
 #endif // Table_h
@@ -0,0 +1,91 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ThreadPool.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Thread pool executing loops within a chare
+  \details   Thread pool executing loops within a chare. ThreadPool is a
+    minimal shared-memory execution layer: a fixed number of persistent worker
+    threads, which, together with the calling thread, execute the iterations of
+    a loop, distributed dynamically. Loops scattering to shared data, e.g.,
+    element loops adding to nodal right hand sides, are made race-free by
+    coloring, see tk::genColors(), and executing the colors one after the
+    other, with the items of a color split into chunks, see tk::chunk().
+*/
+// *****************************************************************************
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include <condition_variable>
+
+namespace tk {
+
+//! \brief Items, e.g., mesh element or face ids, grouped by color and split
+//!   into chunks: outer index: color, middle index: chunk, inner index: item
+using ColoredChunks = std::vector< std::vector< std::vector< std::size_t > > >;
+
+//! Split each color of items into chunks for processing by threads
+ColoredChunks
+chunk( const std::vector< std::vector< std::size_t > >& colors,
+       std::size_t nchunk,
+       std::size_t minsize = 64 );
+
+//! Thread pool executing loops within a chare
+class ThreadPool {
+
+  public:
+    //! Constructor: start worker threads
+    explicit ThreadPool( std::size_t nthread );
+
+    //! Destructor: stop and join worker threads
+    ~ThreadPool() noexcept;
+
+    ThreadPool( const ThreadPool& ) = delete;
+    ThreadPool& operator=( const ThreadPool& ) = delete;
+
+    //! Number of threads executing a loop, including the calling thread
+    std::size_t size() const noexcept { return m_worker.size() + 1; }
+
+    //! Call a function for all iterations of a loop using all threads
+    void run( std::size_t n, const std::function< void(std::size_t) >& f );
+
+    //! Call a function for all chunks of colored items, one color at a time
+    void run( const ColoredChunks& chunks,
+              const std::function< void(const std::vector<std::size_t>&) >& f );
+
+  private:
+    std::vector< std::thread > m_worker;   //!< Worker threads
+    std::mutex m_run;                      //!< Serializes concurrent loops
+    std::mutex m_mutex;                    //!< Protects the state below
+    std::condition_variable m_wake;        //!< Signals a new loop to workers
+    std::condition_variable m_done;        //!< Signals finished workers
+    //! Loop body executed, valid while a loop is being executed
+    const std::function< void(std::size_t) >* m_task;
+    std::size_t m_ntask;                   //!< Number of loop iterations
+    std::atomic< std::size_t > m_next;     //!< Next loop iteration to execute
+    std::size_t m_generation;              //!< Counter of loops started
+    std::size_t m_busy;                    //!< Number of workers still busy
+    bool m_stop;                           //!< True if workers must quit
+    std::exception_ptr m_error;            //!< First exception in a loop
+
+    //! Execute loop iterations until all have been taken
+    void execute();
+
+    //! Worker thread main loop: wait for and execute loops until stopped
+    void work();
+};
+
+//! Access the thread pool shared by all chares of this process
+ThreadPool& threadPool( std::size_t nthread );
+
+} // tk::
+
+#endif // ThreadPool_h
@@ -48,7 +48,8 @@ class CmdLine : public tk::Control<
                   tag::ctrinfo,        tk::ctr::HelpFactory,
                   tag::helpkw,         tk::ctr::HelpKw,
                   tag::error,          std::vector< std::string >,
-                  tag::lbfreq,         kw::lbfreq::info::expect::type > {
+                  tag::lbfreq,         kw::lbfreq::info::expect::type,
+                  tag::chkpfreq,       kw::chkpfreq::info::expect::type > {
 
   public:
     //! \brief Inciter command-line keywords
@@ -68,6 +69,8 @@ class CmdLine : public tk::Control<
                                      , kw::diagnostics
                                      , kw::quiescence
                                      , kw::lbfreq
+                                     , kw::chkpfreq
+                                     , kw::checkpoint
                                      , kw::trace
                                      >;
 
@@ -106,6 +109,7 @@ class CmdLine : public tk::Control<
       set< tag::io, tag::output >( "out" );
       set< tag::io, tag::diag >( "diag" );
       set< tag::io, tag::part >( "track.h5part" );
+      set< tag::io, tag::checkpoint >( "restart" );
       set< tag::virtualization >( 0.0 );
       set< tag::verbose >( false ); // Quiet output by default
       set< tag::chare >( false ); // No chare state output by default
@@ -113,6 +117,7 @@ class CmdLine : public tk::Control<
       set< tag::benchmark >( false ); // No benchmark mode by default
       set< tag::feedback >( false ); // No detailed feedback by default
       set< tag::lbfreq >( 1 ); // Load balancing every time-step by default
+      set< tag::chkpfreq >( 0 ); // No checkpointing by default
       set< tag::trace >( true ); // Output call and stack trace by default
       // Initialize help: fill from own keywords + add map passed in
       brigand::for_each< keywords::set >( tk::ctr::Info(get<tag::cmdinfo>()) );
@@ -139,7 +144,9 @@ class CmdLine : public tk::Control<
                    tag::ctrinfo,        tk::ctr::HelpFactory,
                    tag::helpkw,         tk::ctr::HelpKw,
                    tag::error,          std::vector< std::string >,
-                   tag::lbfreq,         kw::lbfreq::info::expect::type >::pup(p);
+                   tag::lbfreq,         kw::lbfreq::info::expect::type,
+                   tag::chkpfreq,       kw::chkpfreq::info::expect::type >::
+        pup(p);
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
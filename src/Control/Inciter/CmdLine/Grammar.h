@@ -100,6 +100,13 @@ namespace cmd {
                                tk::grm::number,
                                tag::lbfreq > {};
 
+  //! Match and set checkpointing frequency
+  struct chkpfreq :
+         tk::grm::process_cmd< use, kw::chkpfreq,
+                               tk::grm::Store< tag::chkpfreq >,
+                               tk::grm::number,
+                               tag::chkpfreq > {};
+
   //! Match switch on trace output
   struct trace :
          tk::grm::process_cmd_switch< use, kw::trace,
@@ -118,11 +125,13 @@ namespace cmd {
                      helpkw,
                      quiescence,
                      lbfreq,
+                     chkpfreq,
                      trace,
                      io< kw::control, tag::control >,
                      io< kw::input, tag::input >,
                      io< kw::output, tag::output >,
-                     io< kw::diagnostics, tag::diag > > {};
+                     io< kw::diagnostics, tag::diag >,
+                     io< kw::checkpoint, tag::checkpoint > > {};
 
   //! Grammar entry point: parse keywords until end of string
   struct read_string :
@@ -450,16 +450,30 @@ namespace deck {
            tk::grm::discrparam< use, kw::dt, tag::dt >,
            tk::grm::discrparam< use, kw::cfl, tag::cfl >,
            tk::grm::discrparam< use, kw::ctau, tag::ctau >,
+           tk::grm::discrparam< use, kw::lts, tag::lts >,
+           tk::grm::discrparam< use, kw::nthread, tag::nthread >,
+           tk::grm::discrparam< use, kw::pref_tol, tag::pref_tol >,
            tk::grm::process< use< kw::fct >, 
                              tk::grm::Store< tag::discr, tag::fct >,
                              pegtl::alpha >,
+           tk::grm::process< use< kw::fctagg >,
+                             tk::grm::Store< tag::discr, tag::fctagg >,
+                             pegtl::alpha >,
            tk::grm::process< use< kw::reorder >,
                              tk::grm::Store< tag::discr, tag::reorder >,
                              pegtl::alpha >,
+           tk::grm::process< use< kw::quadcache >,
+                             tk::grm::Store< tag::discr, tag::quadcache >,
+                             pegtl::alpha >,
+           tk::grm::process< use< kw::pref >,
+                             tk::grm::Store< tag::discr, tag::pref >,
+                             pegtl::alpha >,
            tk::grm::interval< use< kw::ttyi >, tag::tty >,
            discroption< use, kw::scheme, inciter::ctr::Scheme, tag::scheme >,
            discroption< use, kw::flux, inciter::ctr::Flux, tag::flux >,
            discroption< use, kw::limiter, inciter::ctr::Limiter, tag::limiter >,
+           discroption< use, kw::ordering, tk::ctr::MeshOrdering,
+                        tag::ordering >,
            tk::grm::discrparam< use, kw::cweight, tag::cweight >
          > {};
 
@@ -754,6 +768,12 @@ namespace deck {
                                                tag::selected,
                                                tag::filetype >,
                                              pegtl::alpha >,
+                           tk::grm::process< use< kw::aggregate >,
+                                             tk::grm::store_inciter_option<
+                                               tk::ctr::FieldAggregation,
+                                               tag::selected,
+                                               tag::aggregate >,
+                                             pegtl::alpha >,
                            tk::grm::interval< use< kw::interval >,
                                               tag::field > > > {};
 
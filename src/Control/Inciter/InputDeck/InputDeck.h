@@ -122,11 +122,27 @@ class InputDeck :
                                    kw::filetype,
                                    kw::exodusii,
                                    kw::root,
+                                   kw::aggregate,
+                                   kw::perchare,
+                                   kw::pernode,
+                                   kw::shared,
                                    kw::error,
                                    kw::l2,
                                    kw::linf,
                                    kw::fct,
+                                   kw::fctagg,
                                    kw::reorder,
+                                   kw::ordering,
+                                   kw::bfs,
+                                   kw::rcm,
+                                   kw::hilbert,
+                                   kw::morton,
+                                   kw::natural,
+                                   kw::quadcache,
+                                   kw::lts,
+                                   kw::nthread,
+                                   kw::pref,
+                                   kw::pref_tol,
                                    kw::amr,
                                    kw::amr_t0ref,
                                    kw::amr_dtref,
@@ -188,7 +204,14 @@ class InputDeck :
       set< tag::discr, tag::dt >( 0.0 );
       set< tag::discr, tag::cfl >( 0.0 );
       set< tag::discr, tag::fct >( true );
+      set< tag::discr, tag::fctagg >( true );
       set< tag::discr, tag::reorder >( false );
+      set< tag::discr, tag::ordering >( tk::ctr::MeshOrderingType::NATURAL );
+      set< tag::discr, tag::quadcache >( false );
+      set< tag::discr, tag::lts >( 1 );
+      set< tag::discr, tag::nthread >( 1 );
+      set< tag::discr, tag::pref >( false );
+      set< tag::discr, tag::pref_tol >( 0.05 );
       set< tag::discr, tag::ctau >( 1.0 );
       set< tag::discr, tag::scheme >( SchemeType::DiagCG );
       set< tag::discr, tag::flux >( FluxType::HLLC );
@@ -197,6 +220,9 @@ class InputDeck :
       set< tag::discr, tag::cweight >( 1.0 );
       // Default field output file type
       set< tag::selected, tag::filetype >( tk::ctr::FieldFileType::EXODUSII );
+      // Default field output aggregation: one file per chare
+      set< tag::selected, tag::aggregate >(
+        tk::ctr::FieldAggregationType::PERCHARE );
       // Default AMR settings
       set< tag::amr, tag::amr >( false );
       set< tag::amr, tag::t0ref >( false );
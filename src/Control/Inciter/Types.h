@@ -26,8 +26,10 @@
 #include "Inciter/Options/AMRInitial.h"
 #include "Inciter/Options/AMRError.h"
 #include "Options/PartitioningAlgorithm.h"
+#include "Options/MeshOrdering.h"
 #include "Options/TxtFloatFormat.h"
 #include "Options/FieldFile.h"
+#include "Options/FieldAggregation.h"
 #include "Options/Error.h"
 #include "PUPUtil.h"
 
@@ -40,7 +42,8 @@ using namespace tao;
 using selects = tk::tuple::tagged_tuple<
   tag::pde,         std::vector< ctr::PDEType >,       //!< Partial diff eqs
   tag::partitioner, tk::ctr::PartitioningAlgorithmType,//!< Mesh partitioner
-  tag::filetype,    tk::ctr::FieldFileType           //!< Field output file type
+  tag::filetype,    tk::ctr::FieldFileType,          //!< Field output file type
+  tag::aggregate,   tk::ctr::FieldAggregationType    //!< Field output files
 >;
 
 //! Adaptive-mesh refinement options
@@ -78,7 +81,14 @@ using discretization = tk::tuple::tagged_tuple<
   tag::dt,     kw::dt::info::expect::type,      //!< Size of time step
   tag::cfl,    kw::cfl::info::expect::type,     //!< CFL coefficient
   tag::fct,    bool,                            //!< FCT on/off
+  tag::fctagg, bool,                            //!< FCT comm aggregation
   tag::reorder,bool,                            //!< reordering on/off
+  tag::ordering,tk::ctr::MeshOrderingType,      //!< Reordering algorithm
+  tag::quadcache,bool,                          //!< DG quadrature cache on/off
+  tag::lts,    kw::lts::info::expect::type,     //!< Local time stepping levels
+  tag::nthread,kw::nthread::info::expect::type, //!< Threads per chare
+  tag::pref,   bool,                            //!< p-adaptive DG on/off
+  tag::pref_tol, kw::pref_tol::info::expect::type, //!< p-adaptive tolerance
   tag::ctau,   kw::ctau::info::expect::type,    //!< FCT mass diffisivity
   tag::scheme, inciter::ctr::SchemeType,        //!< Spatial discretization type
   tag::limiter,inciter::ctr::LimiterType,       //!< Limiter type
@@ -111,7 +121,8 @@ using ios = tk::tuple::tagged_tuple<
   tag::input,       std::string,                      //!< Input filename
   tag::output,      std::string,                      //!< Output filename
   tag::diag,        std::string,                      //!< Diagnostics filename
-  tag::part,        std::string                       //!< Particles filename
+  tag::part,        std::string,                      //!< Particles filename
+  tag::checkpoint,  std::string                       //!< Checkpoint directory
 >;
 
 //! Error/diagnostics output configuration
@@ -1015,6 +1015,70 @@ struct filetype_info {
 };
 using filetype = keyword< filetype_info, TAOCPP_PEGTL_STRING("filetype") >;
 
+struct perchare_info {
+  static std::string name() { return "per chare"; }
+  static std::string shortDescription() { return
+    "Select one field output file per chare"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select writing mesh-based field output to one
+    file per chare (worker) in a plotvar ... end block. Example:
+    "aggregate perchare". This is the default. See
+    Control/Options/FieldAggregation.h for other valid options.)"; }
+};
+using perchare = keyword< perchare_info, TAOCPP_PEGTL_STRING("perchare") >;
+
+struct pernode_info {
+  static std::string name() { return "per node"; }
+  static std::string shortDescription() { return
+    "Select one field output file per compute node"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select writing mesh-based field output of all
+    chares (workers) on a logical compute node into a single aggregated file
+    in a plotvar ... end block. Example: "aggregate pernode". The aggregated
+    files can be converted to one ExodusII file per chare by fileconv. See
+    Control/Options/FieldAggregation.h for other valid options.)"; }
+};
+using pernode = keyword< pernode_info, TAOCPP_PEGTL_STRING("pernode") >;
+
+struct shared_info {
+  static std::string name() { return "shared"; }
+  static std::string shortDescription() { return
+    "Select a single field output file shared by all compute nodes"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select writing mesh-based field output of all
+    chares (workers) into a single aggregated file in a plotvar ... end block.
+    Example: "aggregate shared". During time stepping the data is written to
+    one aggregated file per logical compute node, which are merged into a
+    single file at the end of the simulation. The aggregated file can be
+    converted to one ExodusII file per chare by fileconv. See
+    Control/Options/FieldAggregation.h for other valid options.)"; }
+};
+using shared = keyword< shared_info, TAOCPP_PEGTL_STRING("shared") >;
+
+struct aggregate_info {
+  static std::string name() { return "aggregate"; }
+  static std::string shortDescription() { return
+    "Select how field output is aggregated into files"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select how mesh-based field output is
+    aggregated into files in a plotvar ... end block. Writing one file per
+    chare (worker) yields a large number of files with a large number of
+    chares, which burdens the metadata servers of parallel file systems.
+    Aggregating the output into one file per logical compute node or a single
+    file yields far fewer files. Example: "aggregate pernode". Aggregation is
+    supported for ExodusII field output. See
+    Control/Options/FieldAggregation.h for valid options.)"; }
+  struct expect {
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + perchare::string() + "\' | \'"
+                  + pernode::string() + "\' | \'"
+                  + shared::string() + '\'';
+    }
+  };
+};
+using aggregate = keyword< aggregate_info, TAOCPP_PEGTL_STRING("aggregate") >;
+
 struct overwrite_info {
   static std::string name() { return "overwrite"; }
   static std::string shortDescription() { return
@@ -3436,6 +3500,90 @@ struct lbfreq_info {
 };
 using lbfreq = keyword< lbfreq_info, TAOCPP_PEGTL_STRING("lbfreq") >;
 
+struct chkpfreq_info {
+  static std::string name() { return "chkpfreq"; }
+  static std::string shortDescription()
+  { return "Set checkpointing frequency during time stepping"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the frequency, in number of time steps, of
+       writing a checkpoint of the full state of the computation, including
+       global-scope data, such as the input deck, to disk during time
+       stepping. The default is 0, which disables checkpointing. The
+       checkpoint is written into the directory given by the checkpoint
+       keyword, overwriting the previous checkpoint. To restart from a
+       checkpoint, pass '+restart <dir>' to the Charm++ runtime system, on the
+       same number or a different number of PEs, using the same executable.
+       For more information, see the Charm++ manual.)";
+  }
+  using alias = Alias< k >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 0;
+    static constexpr type upper = std::numeric_limits< type >::max()-1;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using chkpfreq = keyword< chkpfreq_info, TAOCPP_PEGTL_STRING("chkpfreq") >;
+
+struct checkpoint_info {
+  static std::string name() { return "checkpoint"; }
+  static std::string shortDescription()
+  { return "Specify the checkpoint directory"; }
+  static std::string longDescription() { return
+    R"(This option is used to define the name of the directory into which
+       checkpoints are written, see also the chkpfreq keyword. The default is
+       'restart'.)";
+  }
+  using alias = Alias< K >;
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+  };
+};
+using checkpoint =
+  keyword< checkpoint_info, TAOCPP_PEGTL_STRING("checkpoint") >;
+
+struct fused_info {
+  static std::string name() { return "fused"; }
+  static std::string shortDescription()
+  { return "Fuse advancing particles with estimating statistics"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to advance the particles by all differential
+       equations and accumulate the statistical moments and the ordinary PDFs
+       in a single sweep over the particles, a chunk of particles at a time,
+       while the chunk is in cache. Central moments are then accumulated about
+       the means of the previous time step and corrected to the means of the
+       current time step, which saves a second sweep over the particles and a
+       second global reduction in every time step. In time steps in which
+       central PDFs are estimated, the statistics are estimated in separate
+       sweeps. Off by default.)";
+  }
+  using alias = Alias< F >;
+};
+using fused = keyword< fused_info, TAOCPP_PEGTL_STRING("fused") >;
+
+struct bulkrng_info {
+  static std::string name() { return "bulkrng"; }
+  static std::string shortDescription()
+  { return "Generate Random123 random numbers in bulk"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to generate uniform and Gaussian random numbers
+       with the Random123 generators in bulk: all words of each generated
+       block are used, a batch of blocks is generated at a time, and Gaussian
+       random numbers are transformed from uniform ones by the Box-Muller
+       transform. This yields higher throughput than the default, which uses
+       a single word of each block. Results remain reproducible for a given
+       seed and number of PEs, but differ from those of the default streams.
+       Off by default.)";
+  }
+  using alias = Alias< B >;
+};
+using bulkrng = keyword< bulkrng_info, TAOCPP_PEGTL_STRING("bulkrng") >;
+
 struct feedback_info {
   static std::string name() { return "feedback"; }
   static std::string shortDescription() { return "Enable on-screen feedback"; }
@@ -3595,12 +3743,12 @@ struct reorder_info {
   static std::string longDescription() { return
     R"(This keyword is used in two different ways: (1) in meshconv as a command
     line argument to instruct the mesh converter to not only convert but also
-    reorder the mesh nodes using the advancing front technique, and (2) in
-    inciter as a keyword in the inciter...end block as "reorder on" (or off) to
-    do (or not do) a global distributed mesh reordering across all PEs that
-    yields an approximately continous mesh node ID order as mesh partitions are
-    assigned to PEs after mesh partitioning. Reordering is optional in meshconv
-    and inciter.)";
+    reorder the mesh nodes, and (2) in inciter as a keyword in the
+    inciter...end block as "reorder on" (or off) to do (or not do) a global
+    distributed mesh reordering across all PEs that yields an approximately
+    continous mesh node ID order as mesh partitions are assigned to PEs after
+    mesh partitioning. Reordering is optional in meshconv and inciter. The
+    reordering algorithm is selected by the keyword 'ordering'.)";
   }
   using alias = Alias< r >;
   struct expect {
@@ -3611,6 +3759,94 @@ struct reorder_info {
 };
 using reorder = keyword< reorder_info, TAOCPP_PEGTL_STRING("reorder") >;
 
+struct bfs_info {
+  static std::string name() { return "advancing front"; }
+  static std::string shortDescription() { return
+    "Select advancing front (breadth-first) mesh node ordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select ordering the mesh nodes by advancing
+    fronts, i.e., by a breadth-first traversal of the mesh graph starting from
+    the first node. Elements keep their order. See
+    Control/Options/MeshOrdering.h for other valid options.)"; }
+};
+using bfs = keyword< bfs_info, TAOCPP_PEGTL_STRING("bfs") >;
+
+struct rcm_info {
+  static std::string name() { return "reverse Cuthill-McKee"; }
+  static std::string shortDescription() { return
+    "Select reverse Cuthill-McKee mesh node ordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select ordering the mesh nodes with the reverse
+    Cuthill-McKee (RCM) algorithm, started from a pseudo-peripheral node of each
+    connected component of the mesh graph. RCM reduces the bandwidth of the
+    mesh graph, i.e., the largest difference between the IDs of nodes sharing
+    an edge. Elements are reordered consistently with their nodes. See
+    Control/Options/MeshOrdering.h for other valid options.)"; }
+};
+using rcm = keyword< rcm_info, TAOCPP_PEGTL_STRING("rcm") >;
+
+struct hilbert_info {
+  static std::string name() { return "Hilbert curve"; }
+  static std::string shortDescription() { return
+    "Select Hilbert space-filling curve mesh node ordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select ordering the mesh nodes along a Hilbert
+    space-filling curve through their coordinates. Elements are reordered
+    consistently with their nodes. See Control/Options/MeshOrdering.h for other
+    valid options.)"; }
+};
+using hilbert = keyword< hilbert_info, TAOCPP_PEGTL_STRING("hilbert") >;
+
+struct morton_info {
+  static std::string name() { return "Morton curve"; }
+  static std::string shortDescription() { return
+    "Select Morton (Z-order) space-filling curve mesh node ordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select ordering the mesh nodes along a Morton
+    (Z-order) space-filling curve through their coordinates. Elements are
+    reordered consistently with their nodes. See Control/Options/MeshOrdering.h
+    for other valid options.)"; }
+};
+using morton = keyword< morton_info, TAOCPP_PEGTL_STRING("morton") >;
+
+struct natural_info {
+  static std::string name() { return "natural"; }
+  static std::string shortDescription() { return
+    "Select keeping the input mesh node ordering"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select keeping the order of the mesh nodes and
+    elements as they appear in the input mesh. In inciter's distributed
+    reordering this assigns new node IDs in the order of the input node IDs.
+    See Control/Options/MeshOrdering.h for other valid options.)"; }
+};
+using natural = keyword< natural_info, TAOCPP_PEGTL_STRING("natural") >;
+
+struct ordering_info {
+  static std::string name() { return "ordering"; }
+  static std::string shortDescription() { return
+    "Select mesh node and element ordering algorithm"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select the algorithm used to order mesh nodes
+    and elements when reordering is enabled: (1) in meshconv as a command line
+    argument, e.g., '-r -O rcm', and (2) in inciter as a keyword in the
+    discretization parameters, e.g., 'reorder true ordering hilbert', where it
+    selects how each chare orders the nodes it assigns new IDs to. The default
+    is 'bfs' in meshconv and 'natural' in inciter. See
+    Control/Options/MeshOrdering.h for valid options.)"; }
+  using alias = Alias< O >;
+  struct expect {
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + bfs::string() + "\' | \'"
+                  + rcm::string() + "\' | \'"
+                  + hilbert::string() + "\' | \'"
+                  + morton::string() + "\' | \'"
+                  + natural::string() + '\'';
+    }
+  };
+};
+using ordering = keyword< ordering_info, TAOCPP_PEGTL_STRING("ordering") >;
+
 struct group_info {
   static std::string name() { return "group"; }
   static std::string shortDescription() { return
@@ -5246,6 +5482,165 @@ struct fct_info {
 };
 using fct = keyword< fct_info, TAOCPP_PEGTL_STRING("fct") >;
 
+struct fctagg_info {
+  static std::string name() { return "Aggregated FCT communication"; }
+  static std::string shortDescription() { return
+    "Turn aggregation of flux-corrected transport communication on/off"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to turn on/off aggregating the chare-boundary
+    communication of flux-corrected transport (FCT) with that of the right
+    hand side. If turned on, the sums of the antidiffusive element
+    contributions are sent to fellow chares in the same message as the right
+    hand side and the mass diffusion, reducing the number of messages per time
+    step and chare-boundary from four to three. If turned off, they are sent
+    separately after the low and high order systems are solved. The setting
+    has no effect when a discontinuous Galerkin scheme is used. Example:
+    "fctagg false".)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using fctagg = keyword< fctagg_info, TAOCPP_PEGTL_STRING("fctagg") >;
+
+struct quadcache_info {
+  static std::string name() { return "Quadrature-point data cache"; }
+  static std::string shortDescription() { return
+    "Turn caching of DG quadrature-point geometry and basis data on/off"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to turn on/off caching of the geometry and
+    basis function data evaluated at the quadrature points of mesh elements and
+    faces used by the discontinuous Galerkin (DG) schemes. If turned on, the
+    physical coordinates of the quadrature points, the basis functions and
+    their derivatives are computed once after the mesh (and ghost data) has
+    been set up and after each mesh refinement step, and reused by every
+    Runge-Kutta stage. This trades memory for not having to recompute the same
+    data during every right-hand side evaluation. The setting has no effect
+    when a continuous Galerkin scheme is used. Example: "quadcache true".)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using quadcache = keyword< quadcache_info, TAOCPP_PEGTL_STRING("quadcache") >;
+
+struct lts_info {
+  static std::string name() { return "Local time stepping levels"; }
+  static std::string shortDescription() { return
+    "Set the number of local time stepping levels for DG"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to configure multi-rate local (element-wise) time
+    stepping for the discontinuous Galerkin (DG) schemes. Mesh elements are
+    binned by their stable time step size into power-of-two levels: elements
+    on level l are advanced with 2^l times the smallest stable time step size
+    at the end of every 2^l-th time step. Faces between elements on different
+    levels, including those across chare boundaries, are integrated at the
+    pace of the finer element and their contributions to the coarser element
+    are accumulated over its time step, so the scheme remains conservative
+    and preserves free stream. Since finer elements see the state of a
+    coarser neighbor frozen at the beginning of its time step, i.e., it is not
+    interpolated in time, the scheme is only first order accurate in time at
+    interfaces between levels. The default, 1, advances all elements with the
+    same time step size. The setting has no effect with a constant time step
+    size, configured by 'dt', or when a continuous Galerkin scheme is used.
+    Example: "lts 4".)"; }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = 16;
+    static std::string description() { return "uint"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using lts = keyword< lts_info, TAOCPP_PEGTL_STRING("lts") >;
+
+struct nthread_info {
+  static std::string name() { return "Threads per chare"; }
+  static std::string shortDescription() { return
+    "Set the number of threads executing the element loops of a chare"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to configure the number of shared-memory threads
+    executing the element and face loops computing the right hand side of the
+    PDEs within a chare. The mesh elements (for continuous Galerkin) or faces
+    (for discontinuous Galerkin) of a chare are colored so that no two entities
+    of the same color scatter to the same node or element and the entities of a
+    color are processed concurrently without atomics. The threads are shared by
+    all chares of a process, thus this setting allows running fewer, larger
+    chares per compute node at the same core utilization, e.g., with a single
+    non-SMP PE per node. The default, 1, runs all loops on the thread of the
+    chare, without coloring. Example: "nthread 8". The same number of threads
+    parse the input mesh if it is in Gmsh or Netgen format. This keyword is
+    also used on the command line of meshconv to configure the number of
+    threads parsing Gmsh and Netgen meshes, e.g., "-j 8".)"; }
+  using alias = Alias< j >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = 1024;
+    static std::string description() { return "uint"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using nthread = keyword< nthread_info, TAOCPP_PEGTL_STRING("nthread") >;
+
+struct pref_info {
+  static std::string name() { return "p-adaptive DG"; }
+  static std::string shortDescription() { return
+    "Turn p-adaptive discontinuous Galerkin (DG) on/off"; }
+  static std::string longDescription() { return
+    R"(This keyword can be used to turn on/off p-adaptivity for the
+    discontinuous Galerkin (DG) schemes. If turned on, the polynomial degree
+    of the numerical solution is selected element by element, between P0 and
+    the degree configured by the 'scheme' keyword, based on a smoothness
+    indicator computed at the beginning of every time step. Elements across
+    which the cell averages jump more than the tolerance configured by
+    'pref_tol' are advanced with a polynomial degree lower by one, those with a
+    jump larger than ten times the tolerance with a degree lower by two. The
+    volume, surface, and source integrals only evaluate the degrees of freedom
+    active on an element. The setting has no effect for DG(P0) or when a
+    continuous Galerkin scheme is used. Example: "pref true".)"; }
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+    static std::string choices() { return "true | false"; }
+  };
+};
+using pref = keyword< pref_info, TAOCPP_PEGTL_STRING("pref") >;
+
+struct pref_tol_info {
+  static std::string name() { return "p-adaptive tolerance"; }
+  static std::string shortDescription() { return
+    "Set the tolerance of the smoothness indicator for p-adaptive DG"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the tolerance of the smoothness indicator
+    used to select the polynomial degree of elements for p-adaptive
+    discontinuous Galerkin (DG) schemes, see also the keyword 'pref'. The
+    indicator is the largest jump in the cell averages of all scalar
+    components across the faces of an element, each normalized by the largest
+    magnitude of the component on the whole mesh, so that the selected
+    degrees are independent of the partitioning. Example:
+    "pref_tol 0.05".)"; }
+  struct expect {
+    using type = tk::real;
+    static constexpr type lower = 0.0;
+    static constexpr type upper = 1.0;
+    static std::string description() { return "real"; }
+    static std::string choices() {
+      return "real between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "]";
+    }
+  };
+};
+using pref_tol = keyword< pref_tol_info, TAOCPP_PEGTL_STRING("pref_tol") >;
+
 ////////// NOT YET FULLY DOCUMENTED //////////
 
 struct mix_iem_info {
@@ -39,6 +39,8 @@ class CmdLine :
                       tag::verbose,    bool,
                       tag::chare,      bool,
                       tag::reorder,    bool,
+                      tag::ordering,   tk::ctr::MeshOrderingType,
+                      tag::nthread,    std::size_t,
                       tag::help,       bool,
                       tag::quiescence, bool,
                       tag::trace,      bool,
@@ -57,6 +59,8 @@ class CmdLine :
                                      , kw::input
                                      , kw::output
                                      , kw::reorder
+                                     , kw::ordering
+                                     , kw::nthread
                                      , kw::quiescence
                                      , kw::trace
                                      >;
@@ -71,6 +75,9 @@ class CmdLine :
       set< tag::verbose >( false ); // Use quiet output by default
       set< tag::chare >( false ); // No chare state output by default
       set< tag::reorder >( false ); // Do not reorder by default
+      // Reorder by advancing fronts if reordering is requested
+      set< tag::ordering >( tk::ctr::MeshOrderingType::BFS );
+      set< tag::nthread >( 1 ); // Parse meshes on a single thread by default
       set< tag::trace >( true ); // Output call and stack trace by default
       // Initialize help: fill from own keywords
       brigand::for_each< keywords::set >( tk::ctr::Info(get<tag::cmdinfo>()) );
@@ -85,6 +92,8 @@ class CmdLine :
                    tag::verbose,    bool,
                    tag::chare,      bool,
                    tag::reorder,    bool,
+                   tag::ordering,   tk::ctr::MeshOrderingType,
+                   tag::nthread,    std::size_t,
                    tag::help,       bool,
                    tag::quiescence, bool,
                    tag::trace,      bool,
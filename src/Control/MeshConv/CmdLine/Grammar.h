@@ -17,6 +17,31 @@
 #include "CommonGrammar.h"
 #include "Keywords.h"
 
+namespace tk {
+namespace grm {
+
+  //! Rule used to trigger action
+  template< class Option, typename... tags >
+  struct store_meshconv_option : pegtl::success {};
+  //! \brief Put option in state at position given by tags
+  //! \details This is a simpler version of tk::grm::store_option for the
+  //!   command line: there are no defaults to warn about overwriting and the
+  //!   option values are not command line keywords (as they have no aliases).
+  template< class Option, typename... tags >
+  struct action< store_meshconv_option< Option, tags... > > {
+    template< typename Input, typename Stack >
+    static void apply( const Input& in, Stack& stack ) {
+      Option opt;
+      if (opt.exist(in.string()))
+        stack.template set< tags... >( opt.value( in.string() ) );
+      else
+        Message< Stack, ERROR, MsgKey::NOOPTION >( stack, in );
+    }
+  };
+
+} // ::grm
+} // ::tk
+
 namespace meshconv {
 //! Mesh converter command line grammar definition
 namespace cmd {
@@ -44,6 +69,21 @@ namespace cmd {
   struct reorder :
          tk::grm::process_cmd_switch< use, kw::reorder, tag::reorder > {};
 
+  //! Match and set mesh ordering algorithm
+  struct ordering :
+         tk::grm::process_cmd< use, kw::ordering,
+                               tk::grm::store_meshconv_option<
+                                 tk::ctr::MeshOrdering, tag::ordering >,
+                               pegtl::alpha,
+                               tag::ordering > {};
+
+  //! Match and set number of threads parsing meshes
+  struct nthread :
+         tk::grm::process_cmd< use, kw::nthread,
+                               tk::grm::Store< tag::nthread >,
+                               tk::grm::number,
+                               tag::nthread > {};
+
   //! \brief Match and set io parameter
   template< typename keyword, typename io_tag >
   struct io :
@@ -73,6 +113,8 @@ namespace cmd {
          pegtl::sor< verbose,
                      charestate,
                      reorder,
+                     ordering,
+                     nthread,
                      help,
                      helpkw,
                      quiescence,
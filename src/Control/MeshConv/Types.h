@@ -18,6 +18,7 @@
 #include "TaggedTuple.h"
 #include "Tags.h"
 #include "Keyword.h"
+#include "Options/MeshOrdering.h"
 
 namespace meshconv {
 namespace ctr {
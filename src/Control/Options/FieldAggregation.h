@@ -0,0 +1,65 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Options/FieldAggregation.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Field output aggregation options
+  \details   Field output aggregation options
+*/
+// *****************************************************************************
+#ifndef FieldAggregationOptions_h
+#define FieldAggregationOptions_h
+
+#include <brigand/sequences/list.hpp>
+
+#include "Toggle.h"
+#include "Keywords.h"
+#include "PUPUtil.h"
+
+namespace tk {
+namespace ctr {
+
+//! Field output aggregation types
+enum class FieldAggregationType : uint8_t { PERCHARE,
+                                            PERNODE,
+                                            SHARED };
+
+//! \brief Pack/Unpack FieldAggregationType: forward overload to generic enum
+//!   class packer
+inline void operator|( PUP::er& p, FieldAggregationType& e )
+{ PUP::pup( p, e ); }
+
+//! \brief FieldAggregation options: outsource searches to base templated on
+//!   enum type
+class FieldAggregation : public tk::Toggle< FieldAggregationType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = brigand::list< kw::perchare
+                                  , kw::pernode
+                                  , kw::shared
+                                  >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit FieldAggregation() :
+      tk::Toggle< FieldAggregationType >(
+        //! Group, i.e., options, name
+        "Field output aggregation",
+        //! Enums -> names
+        { { FieldAggregationType::PERCHARE, kw::perchare::name() },
+          { FieldAggregationType::PERNODE, kw::pernode::name() },
+          { FieldAggregationType::SHARED, kw::shared::name() } },
+        //! keywords -> Enums
+        { { kw::perchare::string(), FieldAggregationType::PERCHARE },
+          { kw::pernode::string(), FieldAggregationType::PERNODE },
+          { kw::shared::string(), FieldAggregationType::SHARED } } ) {}
+};
+
+} // ctr::
+} // tk::
+
+#endif // FieldAggregationOptions_h
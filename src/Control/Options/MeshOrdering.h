@@ -0,0 +1,83 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Options/MeshOrdering.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Mesh node and element ordering algorithm options
+  \details   Mesh node and element ordering algorithm options
+*/
+// *****************************************************************************
+#ifndef MeshOrderingOptions_h
+#define MeshOrderingOptions_h
+
+#include <brigand/sequences/list.hpp>
+
+#include "Toggle.h"
+#include "Keywords.h"
+#include "PUPUtil.h"
+
+namespace tk {
+namespace ctr {
+
+//! Mesh ordering algorithm types
+enum class MeshOrderingType : uint8_t { BFS,
+                                        RCM,
+                                        HILBERT,
+                                        MORTON,
+                                        NATURAL };
+
+//! \brief Pack/Unpack MeshOrderingType: forward overload to generic enum class
+//!   packer
+inline void operator|( PUP::er& p, MeshOrderingType& e ) { PUP::pup( p, e ); }
+
+//! \brief MeshOrdering options: outsource searches to base templated on enum
+//!   type
+class MeshOrdering : public tk::Toggle< MeshOrderingType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = brigand::list< kw::bfs
+                                  , kw::rcm
+                                  , kw::hilbert
+                                  , kw::morton
+                                  , kw::natural
+                                  >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit MeshOrdering() :
+      tk::Toggle< MeshOrderingType >(
+        //! Group, i.e., options, name
+        "Mesh ordering algorithm",
+        //! Enums -> names
+        { { MeshOrderingType::BFS, kw::bfs::name() },
+          { MeshOrderingType::RCM, kw::rcm::name() },
+          { MeshOrderingType::HILBERT, kw::hilbert::name() },
+          { MeshOrderingType::MORTON, kw::morton::name() },
+          { MeshOrderingType::NATURAL, kw::natural::name() } },
+        //! keywords -> Enums
+        { { kw::bfs::string(), MeshOrderingType::BFS },
+          { kw::rcm::string(), MeshOrderingType::RCM },
+          { kw::hilbert::string(), MeshOrderingType::HILBERT },
+          { kw::morton::string(), MeshOrderingType::MORTON },
+          { kw::natural::string(), MeshOrderingType::NATURAL } } ) {}
+
+    //! Query if ordering algorithm also reorders mesh elements
+    //! \param[in] m Enum value of the option requested
+    //! \return True if the elements are reordered consistently with the nodes
+    //! \details Advancing front ordering keeps the element order to remain
+    //!   compatible with meshes reordered earlier.
+    bool elements( MeshOrderingType m ) const {
+      return m == MeshOrderingType::RCM ||
+             m == MeshOrderingType::HILBERT ||
+             m == MeshOrderingType::MORTON;
+    }
+};
+
+} // ctr::
+} // tk::
+
+#endif // MeshOrderingOptions_h
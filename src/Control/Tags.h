@@ -48,14 +48,20 @@ struct benchmark {};
 struct lboff {};
 struct feedback {};
 struct reorder {};
+struct ordering {};
 struct error {};
 struct lbfreq {};
+struct chkpfreq {};
+struct checkpoint {};
+struct fused {};
+struct bulkrng {};
 struct pdf {};
 struct ordpdf {};
 struct cenpdf {};
 struct nchare {};
 struct bounds {};
 struct filetype {};
+struct aggregate {};
 struct pdfpolicy {};
 struct pdfctr {};
 struct pdfnames {};
@@ -104,6 +110,12 @@ struct t0 {};
 struct dt {};
 struct cfl {};
 struct fct {};
+struct fctagg {};
+struct quadcache {};
+struct lts {};
+struct nthread {};
+struct pref {};
+struct pref_tol {};
 struct ctau {};
 struct npar {};
 struct refined {};
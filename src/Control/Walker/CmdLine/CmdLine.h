@@ -39,7 +39,10 @@ class CmdLine : public tk::Control<
                   tag::cmdinfo,        tk::ctr::HelpFactory,
                   tag::ctrinfo,        tk::ctr::HelpFactory,
                   tag::helpkw,         tk::ctr::HelpKw,
-                  tag::error,          std::vector< std::string > > {
+                  tag::error,          std::vector< std::string >,
+                  tag::chkpfreq,       kw::chkpfreq::info::expect::type,
+                  tag::fused,          bool,
+                  tag::bulkrng,        bool > {
 
   public:
     //! Walker command-line keywords
@@ -54,6 +57,10 @@ class CmdLine : public tk::Control<
                                      , kw::stat
                                      , kw::trace
                                      , kw::quiescence
+                                     , kw::chkpfreq
+                                     , kw::checkpoint
+                                     , kw::fused
+                                     , kw::bulkrng
                                      >;
 
     //! \brief Constructor: set all defaults.
@@ -91,10 +98,14 @@ class CmdLine : public tk::Control<
       set< tag::io, tag::output >( "out" );
       set< tag::io, tag::pdf >( "pdf" );
       set< tag::io, tag::stat >( "stat.txt" );
+      set< tag::io, tag::checkpoint >( "restart" );
       set< tag::virtualization >( 0.0 );
       set< tag::verbose >( false ); // Quiet output by default
       set< tag::chare >( false ); // No chare state output by default
       set< tag::trace >( true ); // Output call and stack trace by default
+      set< tag::chkpfreq >( 0 ); // No checkpointing by default
+      set< tag::fused >( false ); // Separate sweeps for statistics by default
+      set< tag::bulkrng >( false ); // One word per Random123 block by default
       // Initialize help: fill from own keywords + add map passed in
       brigand::for_each< keywords::set >( tk::ctr::Info(get<tag::cmdinfo>()) );
       get< tag::ctrinfo >() = std::move( ctrinfo );
@@ -113,7 +124,11 @@ class CmdLine : public tk::Control<
                    tag::cmdinfo,        tk::ctr::HelpFactory,
                    tag::ctrinfo,        tk::ctr::HelpFactory,
                    tag::helpkw,         tk::ctr::HelpKw,
-                   tag::error,          std::vector< std::string > >::pup(p);
+                   tag::error,          std::vector< std::string >,
+                   tag::chkpfreq,       kw::chkpfreq::info::expect::type,
+                   tag::fused,          bool,
+                   tag::bulkrng,        bool >::
+        pup(p);
     }
     friend void operator|( PUP::er& p, CmdLine& c ) { c.pup(p); }
 };
@@ -80,6 +80,23 @@ namespace cmd {
          tk::grm::process_cmd_switch< use, kw::trace,
                                       tag::trace > {};
 
+  //! Match and set checkpointing frequency
+  struct chkpfreq :
+         tk::grm::process_cmd< use, kw::chkpfreq,
+                               tk::grm::Store< tag::chkpfreq >,
+                               tk::grm::number,
+                               tag::chkpfreq > {};
+
+  //! Match switch on fusing advance and statistics
+  struct fused :
+         tk::grm::process_cmd_switch< use, kw::fused,
+                                      tag::fused > {};
+
+  //! Match switch on generating Random123 random numbers in bulk
+  struct bulkrng :
+         tk::grm::process_cmd_switch< use, kw::bulkrng,
+                                      tag::bulkrng > {};
+
   //! command line keywords
   struct keywords :
          pegtl::sor< verbose,
@@ -92,7 +109,11 @@ namespace cmd {
                      trace,
                      io< kw::control, tag::control >,
                      io< kw::pdf, tag::pdf >,
-                     io< kw::stat, tag::stat > > {};
+                     chkpfreq,
+                     io< kw::stat, tag::stat >,
+                     io< kw::checkpoint, tag::checkpoint >,
+                     fused,
+                     bulkrng > {};
 
   //! entry point: parse keywords and until end of string
   struct read_string :
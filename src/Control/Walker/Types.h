@@ -80,7 +80,8 @@ using ios = tk::tuple::tagged_tuple<
   tag::output,          std::string,                  //!< Output filename
   tag::pdf,             kw::pdf::info::expect::type,  //!< PDF filename
   tag::stat,            kw::stat::info::expect::type, //!< Statistics filename
-  tag::pdfnames,        std::vector< std::string >    //!< PDF identifiers
+  tag::pdfnames,        std::vector< std::string >,   //!< PDF identifiers
+  tag::checkpoint,      std::string                   //!< Checkpoint directory
 >;
 
 //! Dirichlet parameters storage
@@ -84,6 +84,7 @@
 #include "DiagOrnsteinUhlenbeckCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 
 namespace walker {
 
@@ -141,24 +142,36 @@ class DiagOrnsteinUhlenbeck {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      auto dW = scratch( work, m_ncomp*ParticleBlock );
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        m_rng.gaussian( stream, m_ncomp*n, dW );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
+          const auto y = particles.cptr( i, m_offset );
+          const auto w = dW + i*n;
+          const tk::real theta = m_theta[i], mu = m_mu[i];
           tk::real d = m_sigmasq[i] * dt;
           d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += m_theta[i]*(m_mu[i] - par)*dt + d*dW[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& par = particles.var( y, b+q );
+            par += theta*(mu - par)*dt + d*w[q];
+          }
         }
       }
     }
@@ -18,11 +18,13 @@
 #define DiffEq_h
 
 #include <string>
+#include <vector>
 #include <functional>
 
 #include "Types.h"
 #include "Make_unique.h"
 #include "Particles.h"
+#include "SystemComponents.h"
 #include "Statistics.h"
 
 namespace walker {
@@ -73,12 +75,20 @@ class DiffEq {
     { self->initialize( stream, particles ); }
 
     //! Public interface to advancing particles in time by the diff eq
+    //! \details The scratch buffer, work, is owned by the caller and reused
+    //!   across calls to avoid allocating memory while advancing particles,
+    //!   see DiffEq/ParticleBlock.h. Only the particles between from and till
+    //!   are advanced, which allows advancing a chunk of particles by all
+    //!   differential equations while it is in cache.
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real t,
-                  const std::map< tk::ctr::Product, tk::real >& moments ) const
-    { self->advance( particles, stream, dt, t, moments ); }
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& work,
+                  tk::ctr::ncomp_type from,
+                  tk::ctr::ncomp_type till ) const
+    { self->advance( particles, stream, dt, t, moments, work, from, till ); }
 
     //! Copy assignment
     DiffEq& operator=( const DiffEq& x )
@@ -103,7 +113,10 @@ class DiffEq {
                             int,
                             tk::real,
                             tk::real,
-                            const std::map< tk::ctr::Product, tk::real >& ) = 0;
+                            const std::map< tk::ctr::Product, tk::real >&,
+                            std::vector< tk::real >&,
+                            tk::ctr::ncomp_type,
+                            tk::ctr::ncomp_type ) = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -118,8 +131,13 @@ class DiffEq {
                     int stream,
                     tk::real dt,
                     tk::real t,
-                    const std::map< tk::ctr::Product, tk::real >& moments )
-      override { data.advance( particles, stream, dt, t, moments ); }
+                    const std::map< tk::ctr::Product, tk::real >& moments,
+                    std::vector< tk::real >& work,
+                    tk::ctr::ncomp_type from,
+                    tk::ctr::ncomp_type till )
+      override {
+        data.advance( particles, stream, dt, t, moments, work, from, till );
+      }
       T data;
     };
 
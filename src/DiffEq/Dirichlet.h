@@ -56,6 +56,7 @@
 #include "DirichletCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 
 namespace walker {
 
@@ -113,29 +114,44 @@ class Dirichlet {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      auto dW = scratch( work, (m_ncomp+1)*ParticleBlock );
+      auto yn = dW + m_ncomp*ParticleBlock;
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Compute Nth scalar
-        tk::real yn = 1.0 - particles(p, 0, m_offset);
-        for (ncomp_t i=1; i<m_ncomp; ++i)
-          yn -= particles( p, i, m_offset );
+        for (ncomp_t q=0; q<n; ++q) yn[q] = 1.0;
+        for (ncomp_t i=0; i<m_ncomp; ++i) {
+          const auto y = particles.cptr( i, m_offset );
+          for (ncomp_t q=0; q<n; ++q) yn[q] -= particles.var( y, b+q );
+        }
 
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        m_rng.gaussian( stream, m_ncomp*n, dW );
 
         // Advance first m_ncomp (K=N-1) scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * yn * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += 0.5*m_b[i]*( m_S[i]*yn - (1.0-m_S[i]) * par )*dt + d*dW[i];
+          const auto y = particles.cptr( i, m_offset );
+          const auto w = dW + i*n;
+          const tk::real k = m_k[i], bi = m_b[i], S = m_S[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& par = particles.var( y, b+q );
+            tk::real d = k * par * yn[q] * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            par += 0.5*bi*( S*yn[q] - (1.0-S) * par )*dt + d*w[q];
+          }
         }
       }
     }
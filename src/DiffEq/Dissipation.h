@@ -23,6 +23,7 @@
 #include "DissipationCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 #include "CoupledEq.h"
 
 namespace walker {
@@ -89,11 +90,17 @@ class Dissipation {
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
     //! \param[in] moments Map of statistical moments
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& moments )
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
       using tk::ctr::lookup;
 
@@ -126,16 +133,20 @@ class Dissipation {
       // Update source based on coefficients policy
       Coefficients::src( Som );
 
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate a Gaussian random number with zero mean and unit variance
-        tk::real dW;
-        m_rng.gaussian( stream, m_ncomp, &dW );
+      const auto o = particles.cptr( 0, m_offset );
+      auto dW = scratch( work, m_ncomp*ParticleBlock );
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
+        // Generate Gaussian random numbers with zero mean and unit variance
+        m_rng.gaussian( stream, m_ncomp*n, dW );
         // Advance particle frequency
-        tk::real& Op = particles( p, 0, m_offset );
-        tk::real d = 2.0*m_c3*m_c4*O*O*Op*dt;
-        d = (d > 0.0 ? std::sqrt(d) : 0.0);
-        Op += (-m_c3*(Op-O) - Som*Op)*O*dt + d*dW;
+        for (ncomp_t q=0; q<n; ++q) {
+          tk::real& Op = particles.var( o, b+q );
+          tk::real d = 2.0*m_c3*m_c4*O*O*Op*dt;
+          d = (d > 0.0 ? std::sqrt(d) : 0.0);
+          Op += (-m_c3*(Op-O) - Som*Op)*O*dt + d*dW[q];
+        }
       }
     }
 
@@ -90,6 +90,7 @@
 #include "GeneralizedDirichletCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 
 namespace walker {
 
@@ -147,42 +148,51 @@ class GeneralizedDirichlet {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Y_i = 1 - sum_{k=1}^{i} y_k
-        std::vector< tk::real > Y( m_ncomp );
-        Y[0] = 1.0 - particles( p, 0, m_offset );
-        for (ncomp_t i=1; i<m_ncomp; ++i)
-          Y[i] = Y[i-1] - particles( p, i, m_offset );
-
-        // U_i = prod_{j=1}^{K-i} 1/Y_{K-j}
-        std::vector< tk::real > U( m_ncomp );
-        U[m_ncomp-1] = 1.0;
-        for (long i=static_cast<long>(m_ncomp)-2; i>=0; --i) {
-          auto j = static_cast< std::size_t >( i );
-          U[j] = U[j+1]/Y[j];
-        }
-
+      auto dW = scratch( work, m_ncomp*ParticleBlock + 2*m_ncomp );
+      auto Y = dW + m_ncomp*ParticleBlock;
+      auto U = Y + m_ncomp;
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Advance first m_ncomp (K=N-1) scalars
-        ncomp_t k=0;
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * Y[m_ncomp-1] * U[i] * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          tk::real a=0.0;
-          for (ncomp_t j=i; j<m_ncomp-1; ++j) a += m_cij[k++]/Y[j];
-          par += U[i]/2.0*( m_b[i]*( m_S[i]*Y[m_ncomp-1] - (1.0-m_S[i])*par ) +
-                            par*Y[m_ncomp-1]*a )*dt + d*dW[i];
+        m_rng.gaussian( stream, m_ncomp*n, dW );
+
+        for (auto p=b; p<b+n; ++p) {
+          // Y_i = 1 - sum_{k=1}^{i} y_k
+          Y[0] = 1.0 - particles( p, 0, m_offset );
+          for (ncomp_t i=1; i<m_ncomp; ++i)
+            Y[i] = Y[i-1] - particles( p, i, m_offset );
+
+          // U_i = prod_{j=1}^{K-i} 1/Y_{K-j}
+          U[m_ncomp-1] = 1.0;
+          for (long i=static_cast<long>(m_ncomp)-2; i>=0; --i) {
+            auto j = static_cast< std::size_t >( i );
+            U[j] = U[j+1]/Y[j];
+          }
+
+          // Advance first m_ncomp (K=N-1) scalars
+          ncomp_t k=0;
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            tk::real& par = particles( p, i, m_offset );
+            tk::real d = m_k[i] * par * Y[m_ncomp-1] * U[i] * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            tk::real a=0.0;
+            for (ncomp_t j=i; j<m_ncomp-1; ++j) a += m_cij[k++]/Y[j];
+            par += U[i]/2.0*( m_b[i]*( m_S[i]*Y[m_ncomp-1] - (1.0-m_S[i])*par )
+                              + par*Y[m_ncomp-1]*a )*dt + d*dW[i*n+p-b];
+          }
         }
       }
     }
@@ -71,6 +71,7 @@
 #include "MassFractionBetaCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 
 namespace walker {
 
@@ -135,27 +136,41 @@ class MassFractionBeta {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
       // Advance particles
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      auto dW = scratch( work, m_ncomp*ParticleBlock );
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        m_rng.gaussian( stream, m_ncomp*n, dW );
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& Y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * Y * (1.0 - Y) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          Y += 0.5*m_b[i]*(m_S[i] - Y)*dt + d*dW[i];
-          // Compute instantaneous values derived from updated Y
-          particles( p, m_ncomp+i, m_offset ) = rho( Y, i );
-          particles( p, m_ncomp*2+i, m_offset ) = vol( Y, i );
+          const auto y = particles.cptr( i, m_offset );
+          const auto r = particles.cptr( m_ncomp+i, m_offset );
+          const auto s = particles.cptr( m_ncomp*2+i, m_offset );
+          const auto w = dW + i*n;
+          const tk::real k = m_k[i], bi = m_b[i], S = m_S[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& Y = particles.var( y, b+q );
+            tk::real d = k * Y * (1.0 - Y) * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            Y += 0.5*bi*(S - Y)*dt + d*w[q];
+            // Compute instantaneous values derived from updated Y
+            particles.var( r, b+q ) = rho( Y, i );
+            particles.var( s, b+q ) = vol( Y, i );
+          }
         }
       }
     }
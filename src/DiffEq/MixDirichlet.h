@@ -58,6 +58,7 @@
 #include "MixDirichletCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 
 namespace walker {
 
@@ -142,42 +143,64 @@ class MixDirichlet {
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
     //! \param[in] moments Map of statistical moments
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& moments )
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
       // Update SDE coefficients
       coeff.update( m_depvar, m_ncomp, moments, m_rho, m_r, m_kprime, m_k,
                     m_S );
       // Advance particles
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      auto dW = scratch( work, (m_ncomp+2)*ParticleBlock );
+      auto yn = dW + m_ncomp*ParticleBlock;
+      auto v = yn + ParticleBlock;
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Compute Nth scalar
-        tk::real yn = 1.0 - particles(p, 0, m_offset);
-        for (ncomp_t i=1; i<m_ncomp; ++i)
-          yn -= particles( p, i, m_offset );
+        for (ncomp_t q=0; q<n; ++q) yn[q] = 1.0;
+        for (ncomp_t i=0; i<m_ncomp; ++i) {
+          const auto y = particles.cptr( i, m_offset );
+          for (ncomp_t q=0; q<n; ++q) yn[q] -= particles.var( y, b+q );
+        }
 
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        m_rng.gaussian( stream, m_ncomp*n, dW );
 
         // Advance first m_ncomp (K=N-1) scalars
-        tk::real v = 1.0;
+        for (ncomp_t q=0; q<n; ++q) v[q] = 1.0;
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& Y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * Y * yn * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          Y += 0.5*m_b[i]*( m_S[i]*yn - (1.0-m_S[i]) * Y )*dt + d*dW[i];
-          v += m_r[i]*Y;
+          const auto y = particles.cptr( i, m_offset );
+          const auto w = dW + i*n;
+          const tk::real k = m_k[i], bi = m_b[i], S = m_S[i], r = m_r[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& Y = particles.var( y, b+q );
+            tk::real d = k * Y * yn[q] * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            Y += 0.5*bi*( S*yn[q] - (1.0-S) * Y )*dt + d*w[q];
+            v[q] += r*Y;
+          }
+        }
+
+        const auto rho = particles.cptr( m_ncomp, m_offset );
+        const auto vol = particles.cptr( m_ncomp+1, m_offset );
+        const auto rhoN = m_rho[m_ncomp];
+        for (ncomp_t q=0; q<n; ++q) {
+          // Finish computing specific volume
+          v[q] /= rhoN;
+          // Compute and store instantaneous density
+          particles.var( rho, b+q ) = 1.0 / v[q];
+          // Store instantaneous specific volume
+          particles.var( vol, b+q ) = v[q];
         }
-        // Finish computing specific volume
-        v /= m_rho[m_ncomp];
-        // Compute and store instantaneous density
-        particles( p, m_ncomp, m_offset ) = 1.0 / v;
-        // Store instantaneous specific volume
-        particles( p, m_ncomp+1, m_offset ) = v;
       }
     }
 
@@ -85,6 +85,7 @@
 #include "MixMassFractionBetaCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 #include "Table.h"
 #include "CoupledEq.h"
 #include "HydroTimeScales.h"
@@ -162,7 +163,7 @@ class MixMassFractionBeta {
           g_inputdeck.get< tag::param, eq, tag::hydrotimescales >().at(c);
         ctr::HydroTimeScales ot;
         // cppcheck-suppress useStlAlgorithm
-        for (auto t : hts) m_hts.push_back( ot.table(t) );
+        for (auto t : hts) m_hts.emplace_back( ot.table(t) );
         Assert( m_hts.size() == m_ncomp, "Number of inverse hydro time scale "
           "tables associated does not match the components integrated" );
 
@@ -171,7 +172,7 @@ class MixMassFractionBeta {
           g_inputdeck.get< tag::param, eq, tag::hydroproductions >().at(c);
         ctr::HydroProductions op;
         // cppcheck-suppress useStlAlgorithm
-        for (auto t : hp) m_hp.push_back( op.table(t) );
+        for (auto t : hp) m_hp.emplace_back( op.table(t) );
         Assert( m_hp.size() == m_ncomp, "Number of hydro "
           "production/dissipation tables associated does not match the "
           "components integrated" );
@@ -199,40 +200,52 @@ class MixMassFractionBeta {
     //! \param[in] dt Time step size
     //! \param[in] t Physical time of the simulation
     //! \param[in] moments Map of statistical moments
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real t,
-                  const std::map< tk::ctr::Product, tk::real >& moments )
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
       // Update SDE coefficients
       coeff.update( m_depvar, m_dissipation_depvar, m_velocity_depvar,
                     m_velocity_solve, m_ncomp, moments, m_bprime, m_kprime,
                     m_rho2, m_r, m_hts, m_hp, m_b, m_k, m_S, t );
       // Advance particles
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      auto dW = scratch( work, m_ncomp*ParticleBlock );
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Access coupled particle velocity
-        tk::real u = 0.0, v = 0.0, w = 0.0;
-        if (m_velocity_coupled) {
-          u = particles( p, 0, m_velocity_offset );
-          v = particles( p, 1, m_velocity_offset );
-          w = particles( p, 2, m_velocity_offset );
-        }
+        m_rng.gaussian( stream, m_ncomp*n, dW );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& Y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * Y * (1.0 - Y) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          Y += 0.5*m_b[i]*(m_S[i] - Y)*dt + d*dW[i]
-               - m_grad[0]*u - m_grad[1]*v - m_grad[2]*w;
-          // Compute instantaneous values derived from updated Y
-          derived( particles, p, i );
+          const auto y = particles.cptr( i, m_offset );
+          const auto dWi = dW + i*n;
+          const tk::real k = m_k[i], bi = m_b[i], S = m_S[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            const auto p = b+q;
+            // Access coupled particle velocity
+            tk::real u = 0.0, v = 0.0, w = 0.0;
+            if (m_velocity_coupled) {
+              u = particles( p, 0, m_velocity_offset );
+              v = particles( p, 1, m_velocity_offset );
+              w = particles( p, 2, m_velocity_offset );
+            }
+            tk::real& Y = particles.var( y, p );
+            tk::real d = k * Y * (1.0 - Y) * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            Y += 0.5*bi*(S - Y)*dt + d*dWi[q]
+                 - m_grad[0]*u - m_grad[1]*v - m_grad[2]*w;
+            // Compute instantaneous values derived from updated Y
+            derived( particles, p, i );
+          }
         }
       }
     }
@@ -270,12 +283,12 @@ class MixMassFractionBeta {
     //! Selected inverse hydrodynamics time scales (if used) for each component
     //! \details This is only used if the coefficients policy is
     //!   MixMassFracBetaCoeffHydroTimeScale. See constructor.
-    std::vector< tk::Table > m_hts;
+    std::vector< tk::CompiledTable > m_hts;
 
     //! Selected hydrodynamics production/dissipation (if used) for each comp.
     //! \details This is only used if the coefficients policy is
     //!   MixMassFracBetaCoeffHydroTimeScale. See constructor.
-    std::vector< tk::Table > m_hp;
+    std::vector< tk::CompiledTable > m_hp;
 
     //! \brief Return density for mass fraction
     //! \details Functional wrapper around the dependent variable of the beta
@@ -64,8 +64,8 @@
           const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
           const std::vector< kw::sde_rho2::info::expect::type >& rho2,
           const std::vector< kw::sde_r::info::expect::type >& r,
-          const std::vector< tk::Table >& hts,
-          const std::vector< tk::Table >& hp,
+          const std::vector< tk::CompiledTable >& hts,
+          const std::vector< tk::CompiledTable >& hp,
           std::vector< kw::sde_b::info::expect::type  >& b,
           std::vector< kw::sde_kappa::info::expect::type >& k,
           std::vector< kw::sde_S::info::expect::type >& S ) const {}
@@ -177,8 +177,8 @@ class MixMassFracBetaCoeffDecay {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >&,
       const std::vector< kw::sde_r::info::expect::type >&,
-      const std::vector< tk::Table >&,
-      const std::vector< tk::Table >&,
+      const std::vector< tk::CompiledTable >&,
+      const std::vector< tk::CompiledTable >&,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >&,
@@ -263,8 +263,8 @@ class MixMassFracBetaCoeffHomDecay {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >& rho2,
       const std::vector< kw::sde_r::info::expect::type >& r,
-      const std::vector< tk::Table >&,
-      const std::vector< tk::Table >&,
+      const std::vector< tk::CompiledTable >&,
+      const std::vector< tk::CompiledTable >&,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >& S,
@@ -388,8 +388,8 @@ class MixMassFracBetaCoeffMonteCarloHomDecay {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >& rho2,
       const std::vector< kw::sde_r::info::expect::type >& r,
-      const std::vector< tk::Table >&,
-      const std::vector< tk::Table >&,
+      const std::vector< tk::CompiledTable >&,
+      const std::vector< tk::CompiledTable >&,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >& S,
@@ -518,8 +518,8 @@ class MixMassFracBetaCoeffHydroTimeScale {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >& rho2,
       const std::vector< kw::sde_r::info::expect::type >& r,
-      const std::vector< tk::Table >& hts,
-      const std::vector< tk::Table >& hp,
+      const std::vector< tk::CompiledTable >& hts,
+      const std::vector< tk::CompiledTable >& hp,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >& S,
@@ -606,15 +606,15 @@ class MixMassFracBetaCoeffHydroTimeScale {
     //! \param[in] t Time at which to sample inverse hydrodynamics time scale
     //! \param[in] ts Hydro time scale table to sample
     //! \return Sampled value from discrete table of inverse hydro time scale
-    tk::real hydrotimescale( tk::real t, const tk::Table& ts ) const
-    { return tk::sample( t, ts ); }
+    tk::real hydrotimescale( tk::real t, const tk::CompiledTable& ts ) const
+    { return ts.sample( t ); }
 
     //! Sample the hydrodynamics production/dissipation rate (P/e) at time t
     //! \param[in] t Time at which to sample hydrodynamics P/e
     //! \param[in] p P/e table to sample
     //! \return Sampled value from discrete table of P/e
-    tk::real hydroproduction( tk::real t, const tk::Table& p ) const
-    { return tk::sample( t, p ); }
+    tk::real hydroproduction( tk::real t, const tk::CompiledTable& p ) const
+    { return p.sample( t ); }
 
     mutable std::size_t m_it = 0;
     mutable std::vector< tk::real > m_s;
@@ -687,8 +687,8 @@ class MixMassFracBetaCoeffInstVel {
       const std::vector< kw::sde_kappaprime::info::expect::type >& kprime,
       const std::vector< kw::sde_rho2::info::expect::type >& rho2,
       const std::vector< kw::sde_r::info::expect::type >& r,
-      const std::vector< tk::Table >&,
-      const std::vector< tk::Table >&,
+      const std::vector< tk::CompiledTable >&,
+      const std::vector< tk::CompiledTable >&,
       std::vector< kw::sde_b::info::expect::type  >& b,
       std::vector< kw::sde_kappa::info::expect::type >& k,
       std::vector< kw::sde_S::info::expect::type >& S,
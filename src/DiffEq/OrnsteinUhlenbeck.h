@@ -89,6 +89,7 @@
 #include "OrnsteinUhlenbeckCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 
 namespace walker {
 
@@ -154,25 +155,38 @@ class OrnsteinUhlenbeck {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      const auto sqrtdt = std::sqrt( dt );
+      auto dW = scratch( work, m_ncomp*ParticleBlock );
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        m_rng.gaussian( stream, m_ncomp*n, dW );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          par += m_theta[i]*(m_mu[i] - par)*dt;
+          const auto y = particles.cptr( i, m_offset );
+          const tk::real theta = m_theta[i], mu = m_mu[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& par = particles.var( y, b+q );
+            par += theta*(mu - par)*dt;
+          }
           for (ncomp_t j=0; j<m_ncomp; ++j) {
-            tk::real d = m_sigma[ j*m_ncomp+i ] * sqrt(dt);     // use transpose
-            par += d*dW[j];
+            const tk::real d = m_sigma[ j*m_ncomp+i ] * sqrtdt;  // transpose
+            const auto w = dW + j*n;
+            for (ncomp_t q=0; q<n; ++q) particles.var( y, b+q ) += d*w[q];
           }
         }
       }
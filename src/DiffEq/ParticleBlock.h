@@ -0,0 +1,66 @@
+// *****************************************************************************
+/*!
+  \file      src/DiffEq/ParticleBlock.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Blocking of particles advanced by differential equations
+  \details   Blocking of particles advanced by differential equations. The
+    differential equations advance particles a block at a time: the random
+    increments for all particles of a block are generated by a single call to
+    the random number generator into a scratch buffer, owned by the caller and
+    reused across blocks and time steps, and the particle update loops run over
+    the particles of a block in the innermost loop. With the equation-major
+    particle data layout, see PARTICLE_DATA_LAYOUT in
+    cmake/ConfigureDataLayout.cmake, the innermost loops access particle
+    properties with unit stride and thus vectorize. With the particle-major
+    layout the innermost loops access particle properties with a stride of the
+    number of particle properties, which, for a block of particles, still
+    stay in cache between the loops over the components of an equation.
+*/
+// *****************************************************************************
+#ifndef ParticleBlock_h
+#define ParticleBlock_h
+
+#include <vector>
+#include <algorithm>
+
+#include "Types.h"
+#include "SystemComponents.h"
+
+namespace walker {
+
+//! Number of particles advanced at a time by differential equations
+static const tk::ctr::ncomp_type ParticleBlock = 256;
+
+//! \brief Number of particles advanced by all differential equations at a time
+//!   if statistics are accumulated in the same sweep, see
+//!   walker::Integrator::advance()
+//! \details This is a multiple of ParticleBlock and is small enough for the
+//!   properties of a chunk of particles to stay in cache between advancing them
+//!   and accumulating their statistics.
+static const tk::ctr::ncomp_type ParticleChunk = 16 * ParticleBlock;
+
+//! Number of particles in a block
+//! \param[in] npar Total number of particles
+//! \param[in] b Index of the first particle of the block
+//! \return Number of particles in the block starting at particle b
+inline tk::ctr::ncomp_type
+blocksize( tk::ctr::ncomp_type npar, tk::ctr::ncomp_type b )
+{ return std::min( ParticleBlock, npar - b ); }
+
+//! Size scratch buffer used to advance a block of particles
+//! \param[in,out] work Scratch buffer, only grown, thus only allocating if it
+//!   is smaller than required, i.e., in the first time step
+//! \param[in] size Number of reals required
+//! \return Pointer to the first real of the scratch buffer
+inline tk::real*
+scratch( std::vector< tk::real >& work, std::size_t size ) {
+  if (work.size() < size) work.resize( size );
+  return work.data();
+}
+
+} // walker::
+
+#endif // ParticleBlock_h
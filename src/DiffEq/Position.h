@@ -79,14 +79,18 @@ class Position {
     //! \brief Advance particles according to the system of beta SDEs
     //! \param[in,out] particles Array of particle properties
     //! \param[in] dt Time step size
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >&,
+                  ncomp_t from,
+                  ncomp_t till )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      for (auto p=from; p<till; ++p) {
         // Access particle velocity
         tk::real u = particles( p, 0, m_velocity_offset );
         tk::real v = particles( p, 1, m_velocity_offset );
@@ -75,6 +75,7 @@
 #include "SkewNormalCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 
 namespace walker {
 
@@ -133,29 +134,41 @@ class SkewNormal {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      auto dW = scratch( work, m_ncomp*ParticleBlock );
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
+        m_rng.gaussian( stream, m_ncomp*n, dW );
 
         // Advance all m_ncomp scalars
         for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& x = particles( p, i, m_offset );
-          tk::real d = 2.0 * m_sigmasq[i] / m_T[i] * dt;
+          const auto y = particles.cptr( i, m_offset );
+          const auto w = dW + i*n;
+          const tk::real T = m_T[i], l = m_lambda[i], s = m_sigmasq[i];
+          tk::real d = 2.0 * s / T * dt;
           d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          x += - ( x - m_lambda[i] * m_sigmasq[i]
-                       * std::sqrt( 2.0 / M_PI )
-                       * std::exp( - m_lambda[i] * m_lambda[i] * x * x / 2.0 )
-                       / ( 1.0 + std::erf( m_lambda[i] * x / std::sqrt(2.0) ) )
-                   ) / m_T[i] * dt
-                 + d*dW[i];
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& x = particles.var( y, b+q );
+            x += - ( x - l * s
+                         * std::sqrt( 2.0 / M_PI )
+                         * std::exp( - l * l * x * x / 2.0 )
+                         / ( 1.0 + std::erf( l * x / std::sqrt(2.0) ) )
+                     ) / T * dt
+                   + d*w[q];
+          }
         }
       }
     }
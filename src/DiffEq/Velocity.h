@@ -25,6 +25,7 @@
 #include "VelocityCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 #include "CoupledEq.h"
 
 namespace walker {
@@ -89,7 +90,7 @@ class Velocity {
           g_inputdeck.get< tag::param, eq, tag::hydrotimescales >().at(c);
         Assert( hts.size() == 1,
                 "Velocity eq Hydrotimescales vector size must be 1" );
-        m_hts = ctr::HydroTimeScales().table( hts[0] );
+        m_hts = tk::CompiledTable( ctr::HydroTimeScales().table( hts[0] ) );
       }
     }
 
@@ -108,11 +109,17 @@ class Velocity {
     //! \param[in] dt Time step size
     //! \param[in] t Physical time of the simulation
     //! \param[in] moments Map of statistical moments
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real t,
-                  const std::map< tk::ctr::Product, tk::real >& moments )
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
       // Update coefficients
       tk::real eps = 0.0;
@@ -131,26 +138,37 @@ class Velocity {
       // Modify G with the mean velocity gradient
       for (std::size_t i=0; i<9; ++i) m_G[i] -= m_dU[i];
 
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      // Compute diffusion
+      tk::real d = m_c0 * eps * dt;
+      d = (d > 0.0 ? std::sqrt(d) : 0.0);
+
+      const auto up = particles.cptr( 0, m_offset );
+      const auto vp = particles.cptr( 1, m_offset );
+      const auto wp = particles.cptr( 2, m_offset );
+      const auto G = m_G;
+      auto dW = scratch( work, m_ncomp*ParticleBlock );
+      // Advance particles a block at a time
+      for (ncomp_t b=from; b<till; b+=ParticleBlock) {
+        const auto n = blocksize( till, b );
         // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-        // Acces particle velocity
-        tk::real& Up = particles( p, 0, m_offset );
-        tk::real& Vp = particles( p, 1, m_offset );
-        tk::real& Wp = particles( p, 2, m_offset );
-        // Compute diffusion
-        tk::real d = m_c0 * eps * dt;
-        d = (d > 0.0 ? std::sqrt(d) : 0.0);
-        // Compute velocity fluctuation
-        tk::real u = Up - U[0];
-        tk::real v = Vp - U[1];
-        tk::real w = Wp - U[2];
-        // Update particle velocity
-        Up += (m_G[0]*u + m_G[1]*v + m_G[2]*w)*dt + d*dW[0];
-        Vp += (m_G[3]*u + m_G[4]*v + m_G[5]*w)*dt + d*dW[1];
-        Wp += (m_G[6]*u + m_G[7]*v + m_G[8]*w)*dt + d*dW[2];
+        m_rng.gaussian( stream, m_ncomp*n, dW );
+        const auto dWu = dW;
+        const auto dWv = dW + n;
+        const auto dWw = dW + 2*n;
+        for (ncomp_t q=0; q<n; ++q) {
+          // Acces particle velocity
+          tk::real& Up = particles.var( up, b+q );
+          tk::real& Vp = particles.var( vp, b+q );
+          tk::real& Wp = particles.var( wp, b+q );
+          // Compute velocity fluctuation
+          tk::real u = Up - U[0];
+          tk::real v = Vp - U[1];
+          tk::real w = Wp - U[2];
+          // Update particle velocity
+          Up += (G[0]*u + G[1]*v + G[2]*w)*dt + d*dWu[q];
+          Vp += (G[3]*u + G[4]*v + G[5]*w)*dt + d*dWv[q];
+          Wp += (G[6]*u + G[7]*v + G[8]*w)*dt + d*dWw[q];
+        }
       }
     }
 
@@ -185,7 +203,7 @@ class Velocity {
     //! Selected inverse hydrodynamics time scale (if used)
     //! \details This is only used if the coefficients policy is
     //!   VelocityCoeffHydroTimeScale. See constructor.
-    tk::Table m_hts;
+    tk::CompiledTable m_hts;
 
     //! Coefficients
     kw::sde_c0::info::expect::type m_c0;
@@ -32,7 +32,7 @@
         void update( char depvar,
                      char dissipation_depvar,
                      const std::map< tk::ctr::Product, tk::real >& moments,
-                     const tk::Table& hts,
+                     const tk::CompiledTable& hts,
                      ctr::DepvarType solve,
                      ctr::VelocityVariantType variant,
                      kw::sde_c0::info::expect::type C0,
@@ -43,7 +43,7 @@
       where _depvar_ is the dependent variable of the velocity equation,
       _dissipation_depvar_ is the dependent variable of the coupled dissipation
       equation, _moments_ if the map of computed statistical moments, _hts_ is
-      a ctr::Table containing the inverse hydrodynamic timescale, _variant_ is
+      a tk::CompiledTable of the inverse hydrodynamic timescale, _variant_ is
       the velocity model variant, _solve_ is the the lable of the dependent
       variable to solve for (full variable or fluctuation), _C0_ is the Langevin
       eq constat to use, _t_ is the physical time, _eps_ is the dissipation rate
@@ -69,6 +69,7 @@
 #include <brigand/sequences/list.hpp>
 
 #include "Types.h"
+#include "Table.h"
 #include "SystemComponents.h"
 #include "Walker/Options/CoeffPolicy.h"
 #include "Langevin.h"
@@ -107,7 +108,7 @@ class VelocityCoeffConstShear {
     void update( char depvar,
                  char dissipation_depvar,
                  const std::map< tk::ctr::Product, tk::real >& moments,
-                 const tk::Table&,
+                 const tk::CompiledTable&,
                  ctr::DepvarType solve,
                  ctr::VelocityVariantType variant,
                  kw::sde_c0::info::expect::type C0,
@@ -174,7 +175,7 @@ class VelocityCoeffStationary {
     void update( char depvar,
                  char,
                  const std::map< tk::ctr::Product, tk::real >& moments,
-                 const tk::Table&,
+                 const tk::CompiledTable&,
                  ctr::DepvarType solve,
                  ctr::VelocityVariantType variant,
                  kw::sde_c0::info::expect::type C0,
@@ -234,7 +235,7 @@ class VelocityCoeffHydroTimeScale {
     void update( char depvar,
                  char,
                  const std::map< tk::ctr::Product, tk::real >& moments,
-                 const tk::Table& hts,
+                 const tk::CompiledTable& hts,
                  ctr::DepvarType solve,
                  ctr::VelocityVariantType,
                  kw::sde_c0::info::expect::type C0,
@@ -260,8 +261,8 @@ class VelocityCoeffHydroTimeScale {
     //! \param[in] t Time at which to sample inverse hydrodynamics time scale
     //! \param[in] ts Hydro time scale table to sample
     //! \return Sampled value from discrete table of inverse hydro time scale
-    tk::real hydrotimescale( tk::real t, const tk::Table& ts ) const
-    { return tk::sample( t, ts ); }
+    tk::real hydrotimescale( tk::real t, const tk::CompiledTable& ts ) const
+    { return ts.sample( t ); }
 };
 
 //! List of all Velocity's coefficients policies
@@ -32,6 +32,7 @@
 #include "WrightFisherCoeffPolicy.h"
 #include "RNG.h"
 #include "Particles.h"
+#include "ParticleBlock.h"
 
 namespace walker {
 
@@ -119,15 +120,23 @@ class WrightFisher {
     //! \param[in,out] particles Array of particle properties
     //! \param[in] stream Thread (or more precisely stream) ID
     //! \param[in] dt Time step size
+    //! \param[in,out] work Scratch buffer, see DiffEq/ParticleBlock.h
+    //! \param[in] from Index of the first particle to advance
+    //! \param[in] till Index of one past the last particle to advance
     void advance( tk::Particles& particles,
                   int stream,
                   tk::real dt,
                   tk::real,
-                  const std::map< tk::ctr::Product, tk::real >& )
+                  const std::map< tk::ctr::Product, tk::real >&,
+                  std::vector< tk::real >& work,
+                  ncomp_t from,
+                  ncomp_t till )
     {
       // Compute sum of coefficients
       const auto omega = std::accumulate( begin(m_omega), end(m_omega), 0.0 );
-      const auto npar = particles.nunk();
+      // Number of Gaussian random numbers used to advance a particle
+      const ncomp_t nw = m_ncomp*(m_ncomp-1)/2;
+      auto dW = scratch( work, nw*ParticleBlock );
 
       #if defined(__clang__)
         #pragma clang diagnostic push
@@ -138,7 +147,13 @@ class WrightFisher {
         #pragma GCC diagnostic ignored "-Wvla"
       #endif
 
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
+      for (auto p=from; p<till; ++p) {
+        // Generate Gaussian random numbers with zero mean and unit variance
+        // for a block of particles
+        if ((p-from) % ParticleBlock == 0)
+          m_rng.gaussian( stream, nw*blocksize( till, p ), dW );
+        const tk::real* w = dW + ((p-from) % ParticleBlock)*nw;
+
         // Need to build the square-root of the Wright-Fisher diffusion matrix:
         // B_ij = y_i * ( delta_ij - y_j ). If the matrix is positive definite,
         // the Cholesky decomposition would work, however, B_ij is only positive
@@ -229,11 +244,7 @@ class WrightFisher {
             // Advance first m_ncomp (K=N-1) particles with Cholesky-decomposed
             // lower triangle (diffusion matrix)
             for (ncomp_t j=0; j<m_ncomp-1; ++j)
-              if (j<=i) {
-                tk::real dW;
-                m_rng.gaussian( stream, 1, &dW );
-                par += B[i][j] * sqrt(dt) * dW;
-              }
+              if (j<=i) par += B[i][j] * sqrt(dt) * *w++;
           }
           // Compute the (N-1)th scalar from unit-sum
           tk::real& par = particles( p, i, m_offset );
@@ -0,0 +1,89 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/AggregateFieldIO.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Aggregated field output file layout
+  \details   Aggregated field output file layout. An aggregated field output
+    file holds the mesh and field output of multiple chares, e.g., all chares
+    on a compute node, in a single file. The file consists of a header
+    followed by records, appended in the order they are written, and an index
+    of all records at the end of the file. Each record holds either the mesh
+    or a field output dump of a single chare, and starts with a record header
+    that identifies the chare and stores the size of the record, so the
+    records can also be found by scanning the file if the index is missing,
+    e.g., after an abnormal termination. All integers are stored as 64-bit
+    unsigned integers and all reals as 64-bit floating-point numbers, in the
+    byte order of the machine that wrote the file.
+*/
+// *****************************************************************************
+#ifndef AggregateFieldIO_h
+#define AggregateFieldIO_h
+
+#include <cstdint>
+
+namespace tk {
+
+//! Aggregated field output file header
+struct AggregateFieldHeader {
+  char magic[8];                //!< File type identifier, "$QField\n"
+  std::uint64_t byteorder;      //!< Byte order marker, 0x0102030405060708
+  std::uint64_t version;        //!< File format version
+};
+
+static_assert( sizeof(AggregateFieldHeader) == 3*sizeof(std::uint64_t),
+               "Aggregated field output header must not be padded" );
+
+//! Aggregated field output record types
+enum AggregateFieldRecordType : std::uint64_t {
+  //! Mesh record: number of elements and nodes, tetrahedron connectivity with
+  //! chare-local node ids, x, y, and z coordinates, followed by the number and
+  //! the names of element and node fields
+  AggregateFieldMesh = 0,
+  //! Field record: number of element fields followed by the size and the
+  //! values of each, then the same for node fields
+  AggregateFieldData = 1
+};
+
+//! Aggregated field output record header, also used as index entry
+struct AggregateFieldRecord {
+  std::uint64_t type;           //!< Record type, AggregateFieldRecordType
+  std::uint64_t chareid;        //!< Chare id the record belongs to
+  std::uint64_t nchare;         //!< Total number of chares
+  std::uint64_t itr;            //!< Iteration count since a new mesh
+  std::uint64_t itf;            //!< Field output iteration count
+  double time;                  //!< Physical time of field output
+  std::uint64_t offset;         //!< Byte offset of record data in file
+  std::uint64_t size;           //!< Size of record data in bytes
+};
+
+static_assert( sizeof(AggregateFieldRecord) == 8*sizeof(std::uint64_t),
+               "Aggregated field output record must not be padded" );
+
+//! Aggregated field output file trailer, written after the index at the end
+struct AggregateFieldTrailer {
+  std::uint64_t nrecord;        //!< Number of records in index
+  std::uint64_t index;          //!< Byte offset of index
+  char magic[8];                //!< Index identifier, "$QIndex\n"
+};
+
+static_assert( sizeof(AggregateFieldTrailer) == 3*sizeof(std::uint64_t),
+               "Aggregated field output trailer must not be padded" );
+
+//! Aggregated field output file type identifier
+static constexpr char AggregateFieldMagic[] = "$QField\n";
+
+//! Aggregated field output index identifier
+static constexpr char AggregateFieldIndexMagic[] = "$QIndex\n";
+
+//! Aggregated field output byte order marker
+static constexpr std::uint64_t AggregateFieldByteOrder = 0x0102030405060708ULL;
+
+//! Aggregated field output file format version
+static constexpr std::uint64_t AggregateFieldVersion = 1;
+
+} // tk::
+
+#endif // AggregateFieldIO_h
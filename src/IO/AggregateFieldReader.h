@@ -0,0 +1,67 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/AggregateFieldReader.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Aggregated field output reader class declaration
+  \details   Aggregated field output reader class declaration. Reads the mesh
+    and field output of multiple chares from a single file.
+*/
+// *****************************************************************************
+#ifndef AggregateFieldReader_h
+#define AggregateFieldReader_h
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Types.h"
+#include "Reader.h"
+#include "UnsMesh.h"
+#include "AggregateFieldIO.h"
+
+namespace tk {
+
+//! Aggregated field output reader
+//! \see tk::AggregateFieldWriter
+class AggregateFieldReader : public Reader {
+
+  public:
+    //! Constructor: verify header and read index
+    explicit AggregateFieldReader( const std::string& filename );
+
+    //! Detect if a file is an aggregated field output file
+    static bool detect( const std::string& filename );
+
+    //! Index of all records in file, in the order they were written
+    const std::vector< AggregateFieldRecord >& index() const
+    { return m_index; }
+
+    //! Read mesh record of a chare
+    void readMesh( const AggregateFieldRecord& r,
+                   std::vector< std::size_t >& inpoel,
+                   UnsMesh::Coords& coord,
+                   std::vector< std::string >& elemfieldnames,
+                   std::vector< std::string >& nodefieldnames );
+
+    //! Read field record of a chare
+    void readFields( const AggregateFieldRecord& r,
+                     std::vector< std::vector< tk::real > >& elemfields,
+                     std::vector< std::vector< tk::real > >& nodefields );
+
+    //! Read the raw data of a record
+    std::vector< char > readData( const AggregateFieldRecord& r );
+
+  private:
+    std::uint64_t m_size;                       //!< File size in bytes
+    std::vector< AggregateFieldRecord > m_index;//!< Index of records in file
+
+    //! Scan file for records if the index is missing
+    void scan();
+};
+
+} // tk::
+
+#endif // AggregateFieldReader_h
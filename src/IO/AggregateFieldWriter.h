@@ -0,0 +1,94 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/AggregateFieldWriter.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Aggregated field output writer class declaration
+  \details   Aggregated field output writer class declaration. Writes the mesh
+    and field output of multiple chares into a single file.
+*/
+// *****************************************************************************
+#ifndef AggregateFieldWriter_h
+#define AggregateFieldWriter_h
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Types.h"
+#include "Writer.h"
+#include "UnsMesh.h"
+#include "AggregateFieldIO.h"
+
+namespace tk {
+
+//! Aggregated field output writer
+//! \details Records are appended to the file as they are written. The index
+//!   of all records is written at the end of the file by the destructor.
+//! \see tk::AggregateFieldRecord
+class AggregateFieldWriter : public Writer {
+
+  public:
+    //! Constructor: create file and write header
+    explicit AggregateFieldWriter( const std::string& filename );
+
+    //! Constructor: continue writing a file at a given record
+    explicit AggregateFieldWriter(
+      const std::string& filename,
+      std::uint64_t offset,
+      const std::vector< AggregateFieldRecord >& index );
+
+    //! Destructor: write index
+    ~AggregateFieldWriter() noexcept;
+
+    //! Write mesh of a chare
+    void writeMesh( int chareid,
+                    int nchare,
+                    uint64_t itr,
+                    const std::vector< std::size_t >& inpoel,
+                    const UnsMesh::Coords& coord,
+                    const std::vector< std::string >& elemfieldnames,
+                    const std::vector< std::string >& nodefieldnames );
+
+    //! Write field output of a chare
+    void writeFields(
+      int chareid,
+      int nchare,
+      uint64_t itr,
+      uint64_t itf,
+      tk::real time,
+      const std::vector< std::vector< tk::real > >& elemfields,
+      const std::vector< std::vector< tk::real > >& nodefields );
+
+    //! Append all records of another aggregated field output file
+    void append( const std::string& filename );
+
+    //! Flush data written to disk
+    void flush();
+
+    //! Query file name
+    //! \return File name
+    const std::string& filename() const { return m_filename; }
+
+    //! Query byte offset of the end of the records written
+    //! \return Byte offset at which the next record is written
+    std::uint64_t offset() const { return m_offset; }
+
+    //! Query index of records written
+    //! \return Index of all records written so far
+    const std::vector< AggregateFieldRecord >& index() const
+    { return m_index; }
+
+  private:
+    std::uint64_t m_offset;                     //!< Byte offset of file end
+    std::vector< AggregateFieldRecord > m_index;//!< Index of records written
+
+    //! Write a record
+    void record( AggregateFieldRecord r, const std::vector< char >& data );
+};
+
+} // tk::
+
+#endif // AggregateFieldWriter_h
@@ -0,0 +1,69 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/BinaryMeshIO.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Quinoa binary mesh file layout
+  \details   Quinoa binary mesh file layout. A binary mesh file consists of a
+    fixed-size header followed by sections of node coordinates, tetrahedron
+    and triangle connectivity, and side set faces. The header stores the byte
+    offsets of all sections, so that each compute node can read a contiguous
+    range of tetrahedra and only the coordinates of the nodes it needs,
+    without parsing the rest of the file. All integers are stored as 64-bit
+    unsigned integers and all coordinates as 64-bit floating-point numbers, in
+    the byte order of the machine that wrote the file.
+*/
+// *****************************************************************************
+#ifndef BinaryMeshIO_h
+#define BinaryMeshIO_h
+
+#include <cstdint>
+#include <cstddef>
+
+namespace tk {
+
+//! Quinoa binary mesh file header
+//! \details The data sections, given by their byte offsets from the beginning
+//!   of the file, are
+//!   - coord: x, y, and z coordinates, each an array of nnode reals,
+//!   - tet: tetrahedron connectivity, ntet*4 zero-based node ids,
+//!   - tri: triangle connectivity, ntri*3 zero-based node ids,
+//!   - sideset: side set table, nsideset entries of {side set id, number of
+//!     faces, index of first face}, followed by the connectivity of all side
+//!     set faces, nsideface*3 zero-based node ids, at offset sideface.
+struct BinaryMeshHeader {
+  char magic[8];                //!< File type identifier, "$QBMesh\n"
+  std::uint64_t byteorder;      //!< Byte order marker, 0x0102030405060708
+  std::uint64_t version;        //!< File format version
+  std::uint64_t nnode;          //!< Number of nodes
+  std::uint64_t ntet;           //!< Number of tetrahedra
+  std::uint64_t ntri;           //!< Number of triangles
+  std::uint64_t nsideset;       //!< Number of side sets
+  std::uint64_t nsideface;      //!< Number of faces in all side sets
+  std::uint64_t coord;          //!< Byte offset of node coordinates
+  std::uint64_t tet;            //!< Byte offset of tetrahedron connectivity
+  std::uint64_t tri;            //!< Byte offset of triangle connectivity
+  std::uint64_t sideset;        //!< Byte offset of side set table
+  std::uint64_t sideface;       //!< Byte offset of side set face connectivity
+};
+
+static_assert( sizeof(BinaryMeshHeader) == 13*sizeof(std::uint64_t),
+               "Binary mesh header must not be padded" );
+
+//! Quinoa binary mesh file type identifier
+static constexpr char BinaryMeshMagic[] = "$QBMesh\n";
+
+//! Quinoa binary mesh byte order marker
+static constexpr std::uint64_t BinaryMeshByteOrder = 0x0102030405060708ULL;
+
+//! Quinoa binary mesh file format version
+static constexpr std::uint64_t BinaryMeshVersion = 1;
+
+//! Number of 64-bit integers in a side set table entry
+static constexpr std::size_t BinaryMeshSidesetEntry = 3;
+
+} // tk::
+
+#endif // BinaryMeshIO_h
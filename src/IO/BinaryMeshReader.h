@@ -0,0 +1,87 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/BinaryMeshReader.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Quinoa binary mesh reader class declaration
+  \details   Quinoa binary mesh reader class declaration. Supports tetrahedra,
+    triangles, and side sets.
+*/
+// *****************************************************************************
+#ifndef BinaryMeshReader_h
+#define BinaryMeshReader_h
+
+#include <map>
+#include <vector>
+#include <unordered_map>
+
+#include "Types.h"
+#include "UnsMesh.h"
+#include "BinaryMeshIO.h"
+
+namespace tk {
+
+class MappedFile;
+
+//! Quinoa binary mesh reader
+//! \details Mesh reader class facilitating reading a mesh from a file in
+//!   Quinoa's indexed binary format. The file is memory-mapped, thus reading a
+//!   part of the mesh, e.g., on a compute node, only reads the ranges of the
+//!   file that hold the data of that part.
+//! \see tk::BinaryMeshHeader
+class BinaryMeshReader {
+
+  public:
+    //! Constructor
+    explicit BinaryMeshReader( const std::string& filename );
+
+    //! Read Quinoa binary mesh
+    void readMesh( UnsMesh& mesh );
+
+    //! Read part of the mesh (graph and coords) from file
+    //! \details Total number of PEs defaults to 1 for a single-CPU read, this
+    //!    PE defaults to 0 for a single-CPU read.
+    void readMeshPart( std::vector< std::size_t >& ginpoel,
+                       std::vector< std::size_t >& inpoel,
+                       std::vector< std::size_t >& triinp,
+                       std::unordered_map< std::size_t, std::size_t >& lid,
+                       tk::UnsMesh::Coords& coord,
+                       int numpes=1, int mype=0 );
+
+    //! Read face list of all side sets from file
+    void
+    readSidesetFaces( std::map< int, std::vector< std::size_t > >& bface,
+                      std::map< int, std::vector< std::size_t > >& faces );
+
+    //! Read face connectivity of all boundary faces from file
+    void readFaces( std::vector< std::size_t >& conn ) const;
+
+    //! Read node list of all side sets from file
+    std::map< int, std::vector< std::size_t > > readSidesetNodes();
+
+    //! Generate triangle face connectivity for side sets of a mesh part
+    std::vector< std::size_t > triinpoel(
+      std::map< int, std::vector< std::size_t > >& bface,
+      const std::map< int, std::vector< std::size_t > >& faces,
+      const std::vector< std::size_t >& ginpoel,
+      const std::vector< std::size_t >& triinp ) const;
+
+  private:
+    const std::string m_filename;       //!< Input file name
+    BinaryMeshHeader m_header;          //!< File header
+
+    //! Copy a range of 64-bit values from the mapped file
+    void copy( const MappedFile& file,
+               std::uint64_t offset,
+               std::size_t n,
+               void* dst ) const;
+
+    //! Read side set table
+    std::vector< std::uint64_t > readSidesets( const MappedFile& file ) const;
+};
+
+} // tk::
+
+#endif // BinaryMeshReader_h
@@ -0,0 +1,48 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/BinaryMeshWriter.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Quinoa binary mesh writer class declaration
+  \details   Quinoa binary mesh writer class declaration. Supports tetrahedra,
+    triangles, and side sets.
+*/
+// *****************************************************************************
+#ifndef BinaryMeshWriter_h
+#define BinaryMeshWriter_h
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "Writer.h"
+
+namespace tk {
+
+class UnsMesh;
+
+//! Quinoa binary mesh writer
+//! \details Mesh writer class facilitating writing a mesh to a file in an
+//!   indexed binary format designed for reading parts of the mesh in parallel.
+//! \see tk::BinaryMeshHeader
+class BinaryMeshWriter : public Writer {
+
+  public:
+    //! Constructor
+    explicit BinaryMeshWriter( const std::string& filename );
+
+    //! Write Quinoa binary mesh
+    void writeMesh( const UnsMesh& mesh );
+
+  private:
+    //! Generate side set table and face connectivity of side sets
+    void sidesets( const UnsMesh& mesh,
+                   std::vector< std::uint64_t >& table,
+                   std::vector< std::size_t >& faces ) const;
+};
+
+} // tk::
+
+#endif // BinaryMeshWriter_h
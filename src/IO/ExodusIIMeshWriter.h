@@ -62,6 +62,9 @@ class ExodusIIMeshWriter {
     void writeMesh( const std::vector< std::size_t >& tetinp,
                     const UnsMesh::Coords& coord ) const;
 
+    //! Flush buffered data of the open ExodusII file to disk
+    void flush() const;
+
     //!  Write time stamp to ExodusII file
     void writeTimeStamp( uint64_t it, tk::real time ) const;
 
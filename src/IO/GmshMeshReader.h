@@ -7,19 +7,22 @@
              All rights reserved. See the LICENSE file for details.
   \brief     Gmsh mesh reader class declaration
   \details   Gmsh mesh reader class declaration. Currently, this class supports
-    line, triangle, tetrahedron, and point Gmsh element types.
+    line, triangle, tetrahedron, and point Gmsh element types. The file is
+    memory-mapped and the nodes and elements of ASCII files are parsed
+    concurrently in chunks of lines.
 */
 // *****************************************************************************
 #ifndef GmshMeshReader_h
 #define GmshMeshReader_h
 
-#include <iosfwd>
 #include <map>
+#include <vector>
 
 #include "Types.h"
 #include "Reader.h"
 #include "GmshMeshIO.h"
 #include "Exception.h"
+#include "MappedFile.h"
 
 namespace tk {
 
@@ -32,25 +35,36 @@ class GmshMeshReader : public Reader {
 
   public:
     //! Constructor
-    explicit GmshMeshReader( const std::string& filename ) :
+    //! \param[in] filename Input mesh filename
+    //! \param[in] nthread Number of threads parsing ASCII sections
+    explicit GmshMeshReader( const std::string& filename,
+                             std::size_t nthread = 1 ) :
       Reader(filename),
+      m_nthread( nthread ),
       m_version( 0.0 ),                        // 0.0: uninitialized
       m_datasize( 0 ),                         //   0: uninitialized
-      m_type( GmshFileType::UNDEFINED )        //  -1: uninitialized
+      m_type( GmshFileType::UNDEFINED ),       //  -1: uninitialized
+      m_tritag()
       {}
 
     //! Read Gmsh mesh
     void readMesh( UnsMesh& mesh );
 
+    //! Physical entity tags of the triangles read
+    //! \return Physical entity tag of each triangle, in the order of the
+    //!   triangle connectivity read by readMesh(), zero if a triangle has no
+    //!   tags
+    const std::vector< int >& triTags() const { return m_tritag; }
+
   private:
     //! Read mandatory "$MeshFormat--$EndMeshFormat" section
-    void readMeshFormat();
+    void readMeshFormat( Scanner& s );
 
     //! Read "$Nodes--$EndNodes" section
-    void readNodes( UnsMesh& mesh );
+    void readNodes( Scanner& s, const char* eof, UnsMesh& mesh );
 
     //! Read "$Elements--$EndElements" section
-    void readElements( UnsMesh& mesh );
+    void readElements( Scanner& s, const char* eof, UnsMesh& mesh );
 
     //! Read "$PhysicalNames--$EndPhysicalNames" section
     void readPhysicalNames() __attribute__ ((noreturn));
@@ -68,9 +82,11 @@ class GmshMeshReader : public Reader {
       return m_type == GmshFileType::BINARY ? true : false;
     }
 
+    std::size_t m_nthread;              //!< Number of threads parsing
     tk::real m_version;                 //!< Mesh version in mesh file
     int m_datasize;                     //!< Data size in mesh file
     GmshFileType m_type;                //!< Mesh file type: 0:ASCII, 1:binary
+    std::vector< int > m_tritag;        //!< Physical entity tags of triangles
 
     //! \brief Gmsh element types and their corrseponding number of nodes
     //! \details See Gmsh documentation for element ids as keys
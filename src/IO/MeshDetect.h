@@ -22,12 +22,14 @@ enum class MeshReaderType : uint8_t { GMSH=0,
                                       EXODUSII,
                                       HYPER,
                                       ASC,
-                                      OMEGA_H };
+                                      OMEGA_H,
+                                      BINARY };
 
 //! Supported mesh writers
 enum class MeshWriterType : uint8_t { GMSH=0,
                                       NETGEN,
-                                      EXODUSII };
+                                      EXODUSII,
+                                      BINARY };
 
 //! Detect input mesh file type
 MeshReaderType
@@ -18,6 +18,7 @@
 #include "Types.h"
 #include "UnsMesh.h"
 #include "Print.h"
+#include "Options/MeshOrdering.h"
 
 namespace tk {
 
@@ -25,14 +26,16 @@ namespace tk {
 UnsMesh
 readUnsMesh( const tk::Print& print,
              const std::string& filename,
-             std::pair< std::string, tk::real >& timestamp );
+             std::pair< std::string, tk::real >& timestamp,
+             std::size_t nthread = 1 );
 
 //! Write unstructured mesh to file
 std::vector< std::pair< std::string, tk::real > >
 writeUnsMesh( const tk::Print& print,
               const std::string& filename,
               UnsMesh& mesh,
-              bool reorder );
+              bool reorder,
+              ctr::MeshOrderingType ordering = ctr::MeshOrderingType::BFS );
 
 } // tk::
 
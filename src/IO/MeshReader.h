@@ -21,6 +21,10 @@
 #include "MeshDetect.h"
 #include "Make_unique.h"
 #include "ExodusIIMeshReader.h"
+#include "BinaryMeshReader.h"
+#include "GmshMeshReader.h"
+#include "NetgenMeshReader.h"
+#include "PartialMeshReader.h"
 
 #ifdef HAS_OMEGA_H
   #include "Omega_h_MeshReader.h"
@@ -35,20 +39,32 @@ namespace tk {
 //!   enabling client-side value semantics. Credit goes to Sean Parent at Adobe.
 //! \see http://sean-parent.stlab.cc/papers-and-presentations/#value-semantics-and-concept-based-polymorphism.
 //! \see For example client code that models a MeshReader, see
-//!   tk::ExodusIIMeshReader or tk::Omega_h_MeshReader.
+//!   tk::ExodusIIMeshReader, tk::BinaryMeshReader, or tk::Omega_h_MeshReader.
 class MeshReader {
 
   public:
     //! Constructor
     //! \param[in] filename Input mesh filename
+    //! \param[in] nthread Number of threads parsing text mesh formats read as
+    //!   a whole, see tk::PartialMeshReader
     //! \details Dispatch constructor call to various low level mesh readers by
     //!    creating child class and assigning to base to be used in polymorphic
     //!    fashion.
-    explicit MeshReader( const std::string& filename ) {
+    explicit MeshReader( const std::string& filename,
+                         std::size_t nthread = 1 ) {
       auto meshtype = detectInput( filename );
       if (meshtype == MeshReaderType::EXODUSII) {
         using R = ExodusIIMeshReader;
         self = make_unique< Model<R> >( R(filename) );
+      } else if (meshtype == MeshReaderType::BINARY) {
+        using R = BinaryMeshReader;
+        self = make_unique< Model<R> >( R(filename) );
+      } else if (meshtype == MeshReaderType::GMSH) {
+        using R = PartialMeshReader< GmshMeshReader >;
+        self = make_unique< Model<R> >( R(filename,nthread) );
+      } else if (meshtype == MeshReaderType::NETGEN) {
+        using R = PartialMeshReader< NetgenMeshReader >;
+        self = make_unique< Model<R> >( R(filename,nthread) );
       #ifdef HAS_OMEGA_H
       } else if (meshtype == MeshReaderType::OMEGA_H) {
         using R = Omega_h_MeshReader;
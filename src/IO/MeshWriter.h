@@ -9,7 +9,10 @@
   \details   Charm++ group declaration used to output data associated to
      unstructured meshes to file(s). Charm++ chares (work units) send mesh and
      field data associated to mesh entities to the MeshWriter class defined here
-     to write the data to file(s).
+     to write the data to file(s). The data is written asynchronously by a
+     dedicated I/O thread, so the chares can continue computing while their
+     data is being written. If the I/O thread falls behind, the chares are
+     held back by delaying their callbacks, without blocking the PE.
 */
 // *****************************************************************************
 #ifndef MeshWriter_h
@@ -19,9 +22,18 @@
 #include <string>
 #include <tuple>
 #include <map>
+#include <list>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <exception>
+#include <condition_variable>
 
 #include "Types.h"
+#include "Timer.h"
 #include "Options/FieldFile.h"
+#include "Options/FieldAggregation.h"
 #include "Centering.h"
 #include "UnsMesh.h"
 
@@ -29,18 +41,35 @@
 
 namespace tk {
 
+class ExodusIIMeshWriter;
+class AggregateFieldWriter;
+
 //! Charm++ group used to output particle data to file in parallel
 class MeshWriter : public CBase_MeshWriter {
 
   public:
     //! Constructor: set some defaults that stay constant at all times
     MeshWriter( ctr::FieldFileType filetype,
+                ctr::FieldAggregationType aggregate,
                 Centering bnd_centering,
                 bool benchmark );
 
+    #if defined(__clang__)
+      #pragma clang diagnostic push
+      #pragma clang diagnostic ignored "-Wundefined-func-template"
+    #endif
+    //! Migrate constructor
+    explicit MeshWriter( CkMigrateMessage* m );
+    #if defined(__clang__)
+      #pragma clang diagnostic pop
+    #endif
+
     //! Set the total number of chares
     void nchare( int n );
 
+    //! Destructor: write queued data and stop I/O thread
+    ~MeshWriter() noexcept;
+
     //! Output unstructured mesh into file
     void write( bool meshoutput,
                 bool fieldoutput,
@@ -49,32 +78,131 @@ class MeshWriter : public CBase_MeshWriter {
                 tk::real time,
                 int chareid,
                 const std::string& basefilename,
-                const std::vector< std::size_t >& inpoel,
-                const UnsMesh::Coords& coord,
-                const std::map< int, std::vector< std::size_t > >& bface,
-                const std::map< int, std::vector< std::size_t > >& bnode,
-                const std::vector< std::size_t >& triinpoel,
-                const std::vector< std::string >& elemfieldnames,
-                const std::vector< std::string >& nodefieldnames,
-                const std::vector< std::vector< tk::real > >& elemfields,
-                const std::vector< std::vector< tk::real > >& nodefields,
+                std::vector< std::size_t > inpoel,
+                UnsMesh::Coords coord,
+                std::map< int, std::vector< std::size_t > > bface,
+                std::map< int, std::vector< std::size_t > > bnode,
+                std::vector< std::size_t > triinpoel,
+                std::vector< std::string > elemfieldnames,
+                std::vector< std::string > nodefieldnames,
+                std::vector< std::vector< tk::real > > elemfields,
+                std::vector< std::vector< tk::real > > nodefields,
                 CkCallback c );
 
+    //! Wait for all queued data to be written and close all files
+    void flush( CkCallback c );
+
+    //! Merge the aggregated files of all compute nodes into a single file
+    void merge( const std::string& basefilename, CkCallback c );
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    void pup( PUP::er &p ) override;
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] m MeshWriter object reference
+    friend void operator|( PUP::er& p, MeshWriter& m ) { m.pup(p); }
+    //@}
+
   private:
     //! Output file format type
-    const ctr::FieldFileType m_filetype;
+    ctr::FieldFileType m_filetype;
+    //! Field output aggregation type
+    ctr::FieldAggregationType m_aggregate;
     //! Centering to identify what boundary data to write.
-    const Centering m_bndCentering;
+    Centering m_bndCentering;
     //! True if benchmark mode
-    const bool m_benchmark;
+    bool m_benchmark;
 
     //! Total number chares across the whole problem
     int m_nchare;
 
+    //! Data of a single write request owned by the writer until written
+    struct Snapshot {
+      bool meshoutput;
+      bool fieldoutput;
+      uint64_t itr;
+      uint64_t itf;
+      tk::real time;
+      int chareid;
+      int nchare;
+      std::string filename;
+      std::string aggfilename;
+      std::vector< std::size_t > inpoel;
+      UnsMesh::Coords coord;
+      std::map< int, std::vector< std::size_t > > bface;
+      std::map< int, std::vector< std::size_t > > bnode;
+      std::vector< std::size_t > triinpoel;
+      std::vector< std::string > elemfieldnames;
+      std::vector< std::string > nodefieldnames;
+      std::vector< std::vector< tk::real > > elemfields;
+      std::vector< std::vector< tk::real > > nodefields;
+    };
+
+    //! Callback of a chare held back until its snapshot fits in the queue
+    struct Pending {
+      CkCallback callback;
+      tk::Timer timer;
+    };
+
+    //! \brief Maximum number of snapshots queued whose chares may continue,
+    //!   including the one being written
+    static const std::size_t m_maxqueue = 2;
+    //! Maximum number of ExodusII files kept open
+    static const std::size_t m_maxexo = 16;
+    //! Interval in milliseconds of polling for space in the queue
+    static constexpr double m_pollms = 1.0;
+
+    std::thread m_io;                   //!< I/O thread, started on first write
+    std::mutex m_mutex;                 //!< Protects the state below
+    std::condition_variable m_work;     //!< Signals a new snapshot or stop
+    std::condition_variable m_space;    //!< Signals a written snapshot
+    //! Snapshots to be written, front is being written by the I/O thread
+    std::deque< Snapshot > m_queue;
+    //! \brief Callbacks of the chares of the snapshots at the back of the
+    //!   queue beyond m_maxqueue, in queue order (only accessed on the PE)
+    std::deque< Pending > m_pending;
+    //! Callback to send the timing to once the queue is empty, see flush()
+    std::unique_ptr< CkCallback > m_flushed;
+    bool m_polling;                     //!< True if polling is scheduled
+    bool m_stop;                        //!< True if the I/O thread must quit
+    std::exception_ptr m_error;         //!< First exception in the I/O thread
+    tk::real m_writetime;               //!< Time spent writing (I/O thread)
+    tk::real m_waittime;                //!< Time chares waited for the writer
+    //! \brief ExodusII files kept open across field output dumps, at most one
+    //!   per chare and at most m_maxexo, most recently used first
+    std::list< std::pair< int, std::unique_ptr< ExodusIIMeshWriter > > > m_exo;
+    //! Aggregated file of all chares on this compute node (if aggregating)
+    std::unique_ptr< AggregateFieldWriter > m_agg;
+
     //! Compute filename
     std::string filename( const std::string& basefilename,
                           uint64_t itr,
                           int chareid ) const;
+
+    //! Compute filename of aggregated field output
+    std::string aggfilename( const std::string& basefilename, int node ) const;
+
+    //! I/O thread main loop: write queued snapshots until stopped
+    void drain();
+
+    //! Write a snapshot to file
+    void output( const Snapshot& s );
+
+    //! Open the ExodusII file of a chare or find it among those kept open
+    ExodusIIMeshWriter& exodus( int chareid,
+                                const std::string& filename,
+                                bool create );
+
+    //! Wait for the queue to have at most a given number of snapshots
+    void wait( std::size_t n );
+
+    //! Send the callbacks of chares whose snapshots fit in the queue
+    void resume();
+
+    //! Poll for space in the queue, called by the Charm++ scheduler
+    static void poll( void* self, double );
 };
 
 } // tk::
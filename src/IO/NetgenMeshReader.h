@@ -12,9 +12,10 @@
 #ifndef NetgenMeshReader_h
 #define NetgenMeshReader_h
 
-#include <iosfwd>
+#include <vector>
 
 #include "Reader.h"
+#include "MappedFile.h"
 
 namespace tk {
 
@@ -28,18 +29,37 @@ class NetgenMeshReader : public Reader {
 
   public:
     //! Constructor
-    explicit NetgenMeshReader( const std::string& filename ) :
-      Reader( filename ) {}
+    //! \param[in] filename Input mesh filename
+    //! \param[in] nthread Number of threads parsing nodes and elements
+    explicit NetgenMeshReader( const std::string& filename,
+                               std::size_t nthread = 1 ) :
+      Reader( filename ), m_nthread( nthread ), m_tritag() {}
 
     //! Read Netgen mesh
     void readMesh( UnsMesh& mesh );
 
+    //! Boundary condition tags of the triangles read
+    //! \return Boundary condition tag of each triangle (surface element), in
+    //!   the order of the triangle connectivity read by readMesh()
+    const std::vector< int >& triTags() const { return m_tritag; }
+
   private:
     //! Read nodes
-    void readNodes( UnsMesh& mesh );
+    void readNodes( Scanner& s, const char* eof, UnsMesh& mesh );
 
     //! Read element connectivity
-    void readElements( UnsMesh& mesh );
+    void readElements( Scanner& s, const char* eof, UnsMesh& mesh );
+
+    //! Read a block of elements
+    void readElemBlock( Scanner& s,
+                        const char* eof,
+                        std::size_t nnpe,
+                        const std::string& name,
+                        std::vector< std::size_t >& inpoel,
+                        std::vector< int >* tag );
+
+    std::size_t m_nthread;              //!< Number of threads parsing
+    std::vector< int > m_tritag;        //!< Boundary condition tags of triangles
 };
 
 } // tk::
@@ -0,0 +1,211 @@
+// *****************************************************************************
+/*!
+  \file      src/IO/PartialMeshReader.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Partial mesh reader for mesh formats read as a whole
+  \details   Partial mesh reader for mesh formats read as a whole. Text mesh
+    formats, e.g., Gmsh and Netgen, cannot be read in contiguous ranges
+    without parsing the file up to the range. This class template reads the
+    whole mesh on each compute node concurrently, using the multi-threaded
+    parser of the underlying reader, and keeps this compute node's part. Side
+    sets are formed by the triangles sharing the same tag: the physical entity
+    in Gmsh files and the boundary condition number in Netgen files. For
+    meshes too large to be read by each compute node, convert the mesh to
+    Quinoa's binary format with meshconv, see tk::BinaryMeshReader.
+*/
+// *****************************************************************************
+#ifndef PartialMeshReader_h
+#define PartialMeshReader_h
+
+#include <map>
+#include <array>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "Types.h"
+#include "Exception.h"
+#include "ContainerUtil.h"
+#include "UnsMesh.h"
+#include "Reorder.h"
+#include "DerivedData.h"
+
+namespace tk {
+
+//! Partial mesh reader for mesh formats read as a whole
+//! \tparam Reader Mesh reader type with a readMesh( UnsMesh& ) member function
+//!   and a triTags() member function returning the tags of triangles read
+//! \details The mesh is read once, at construction, and all queries are
+//!   answered from the mesh kept. Side set faces are referred to by their
+//!   triangle ids in the file, consistent with tk::BinaryMeshReader.
+template< class Reader >
+class PartialMeshReader {
+
+  public:
+    //! Constructor: read mesh and form side sets from triangle tags
+    //! \param[in] filename Input mesh filename
+    //! \param[in] nthread Number of threads parsing the mesh file
+    explicit PartialMeshReader( const std::string& filename,
+                                std::size_t nthread = 1 )
+      : m_mesh(), m_sideset()
+    {
+      Reader r( filename, nthread );
+      r.readMesh( m_mesh );
+      const auto& tag = r.triTags();
+      Assert( tag.size() == m_mesh.triinpoel().size()/3,
+              "Number of triangle tags and triangles must equal" );
+      for (std::size_t t=0; t<tag.size(); ++t)
+        if (tag[t] > 0) m_sideset[ tag[t] ].push_back( t );
+    }
+
+    //! Read part of the mesh (graph and coords) from file
+    //! \param[in,out] ginpoel Container to store element connectivity of this
+    //!   PE's chunk of the mesh (global ids)
+    //! \param[in,out] inpoel Container to store element connectivity with
+    //!   local node IDs of this PE's mesh chunk
+    //! \param[in,out] triinp Container to store triangle element connectivity
+    //!   (if exists in file) with global node indices
+    //! \param[in,out] lid Container to store global->local node IDs of
+    //!   elements of this PE's mesh chunk
+    //! \param[in,out] coord Container to store coordinates of mesh nodes of
+    //!   this PE's mesh chunk
+    //! \param[in] numpes Total number of PEs (default n = 1, for a single-CPU
+    //!   read)
+    //! \param[in] mype This PE (default m = 0, for a single-CPU read)
+    void readMeshPart( std::vector< std::size_t >& ginpoel,
+                       std::vector< std::size_t >& inpoel,
+                       std::vector< std::size_t >& triinp,
+                       std::unordered_map< std::size_t, std::size_t >& lid,
+                       tk::UnsMesh::Coords& coord,
+                       int numpes=1, int mype=0 )
+    {
+      Assert( mype < numpes, "Invalid input: PE id must be lower than NumPEs" );
+      Assert( ginpoel.empty() && inpoel.empty() && lid.empty() &&
+              coord[0].empty() && coord[1].empty() && coord[2].empty(),
+              "Containers to store mesh must be empty" );
+
+      const auto& tetinpoel = m_mesh.tetinpoel();
+
+      // Compute extents of element IDs of this PE's mesh chunk to keep
+      auto nel = tetinpoel.size()/4;
+      auto npes = static_cast< std::size_t >( numpes );
+      auto pe = static_cast< std::size_t >( mype );
+      auto chunk = nel / npes;
+      auto from = pe * chunk;
+      auto till = from + chunk;
+      if (pe == npes-1) till += nel % npes;
+
+      ginpoel.assign( tetinpoel.begin() + static_cast< long >( from*4 ),
+                      tetinpoel.begin() + static_cast< long >( till*4 ) );
+
+      // Compute local data from global mesh connectivity
+      std::vector< std::size_t > gid;
+      std::tie( inpoel, gid, lid ) = tk::global2local( ginpoel );
+
+      // Keep the coordinates of this PE's mesh chunk
+      const std::array< const std::vector< real >*, 3 >
+        xyz{{ &m_mesh.x(), &m_mesh.y(), &m_mesh.z() }};
+      for (std::size_t d=0; d<3; ++d) {
+        coord[d].resize( gid.size() );
+        for (std::size_t i=0; i<gid.size(); ++i)
+          coord[d][i] = (*xyz[d])[ gid[i] ];
+      }
+
+      // Keep triangles that are faces of this PE's mesh chunk
+      const auto faces = genTetFaces( ginpoel );
+      const auto& tri = m_mesh.triinpoel();
+      for (std::size_t t=0; t<tri.size()/3; ++t)
+        if (faces.find( {{ tri[t*3+0], tri[t*3+1], tri[t*3+2] }} ) !=
+            end(faces))
+          triinp.insert( end(triinp),
+                         tri.begin() + static_cast< long >( t*3 ),
+                         tri.begin() + static_cast< long >( t*3+3 ) );
+    }
+
+    //! Read face list of all side sets from file
+    //! \param[in,out] bface Triangle ids of side sets to read into
+    //! \param[in,out] faces Elem-relative face ids of side sets, all zero,
+    //!   since side set faces are referred to by their triangle ids
+    void
+    readSidesetFaces( std::map< int, std::vector< std::size_t > >& bface,
+                      std::map< int, std::vector< std::size_t > >& faces )
+    {
+      for (const auto& s : m_sideset) {
+        bface[ s.first ] = s.second;
+        faces[ s.first ].assign( s.second.size(), 0 );
+      }
+    }
+
+    //! Read face connectivity of all boundary faces from file
+    //! \param[in,out] conn Connectivity vector to push to
+    void readFaces( std::vector< std::size_t >& conn ) const {
+      const auto& tri = m_mesh.triinpoel();
+      conn.insert( end(conn), begin(tri), end(tri) );
+    }
+
+    //! Read node list of all side sets from file
+    //! \return Node lists mapped to side set ids
+    std::map< int, std::vector< std::size_t > > readSidesetNodes() {
+      const auto& tri = m_mesh.triinpoel();
+      std::map< int, std::vector< std::size_t > > side;
+      for (const auto& s : m_sideset) {
+        auto& list = side[ s.first ];
+        for (auto t : s.second)
+          list.insert( end(list), tri.begin() + static_cast< long >( t*3 ),
+                                  tri.begin() + static_cast< long >( t*3+3 ) );
+        tk::unique( list );
+      }
+      return side;
+    }
+
+    //! Generate triangle face connectivity for side sets of a mesh part
+    //! \param[in,out] bface Triangle ids of side sets, see readSidesetFaces(),
+    //!   converted to part-local face ids
+    //! \param[in] ginpoel Tetrahedron element connectivity with global nodes
+    //! \return Triangle face connectivity with global node IDs of side sets
+    //! \details Keeps those side set faces that are faces of the tetrahedra of
+    //!   a mesh part, consistent with tk::BinaryMeshReader::triinpoel().
+    std::vector< std::size_t > triinpoel(
+      std::map< int, std::vector< std::size_t > >& bface,
+      const std::map< int, std::vector< std::size_t > >&,
+      const std::vector< std::size_t >& ginpoel,
+      const std::vector< std::size_t >& ) const
+    {
+      const auto& tri = m_mesh.triinpoel();
+      const auto partfaces = genTetFaces( ginpoel );
+
+      std::vector< std::size_t > bnd_triinpoel;
+      std::map< int, std::vector< std::size_t > > bface_own;
+
+      std::size_t f = 0;            // counts faces on this PE
+      for (const auto& ss : bface) {
+        auto& b = bface_own[ ss.first ];
+        for (auto t : ss.second) {
+          Assert( t < tri.size()/3, "Indexing out of triangles" );
+          UnsMesh::Face face{{ tri[t*3+0], tri[t*3+1], tri[t*3+2] }};
+          if (partfaces.find( face ) != end(partfaces)) {
+            bnd_triinpoel.insert( end(bnd_triinpoel), begin(face), end(face) );
+            b.push_back( f++ );
+          }
+        }
+        if (b.empty()) bface_own.erase( ss.first );
+      }
+
+      bface = std::move(bface_own);
+
+      return bnd_triinpoel;
+    }
+
+  private:
+    //! Mesh read
+    UnsMesh m_mesh;
+    //! Triangle ids of side sets mapped to side set (triangle tag) ids
+    std::map< int, std::vector< std::size_t > > m_sideset;
+};
+
+} // tk::
+
+#endif // PartialMeshReader_h
@@ -10,7 +10,8 @@
     using a continuous Galerkin (CG) finite element (FE) spatial discretization
     (using linear shapefunctions on tetrahedron elements) combined with a
     Runge-Kutta (RK) time stepping scheme in the arbitrary Eulerian-Lagrangian
-    reference frame.
+    reference frame. The right-hand side is assembled by a sweep over the mesh
+    edges and is stabilized by an edge-based artificial viscosity.
 
     There are a potentially large number of ALECG Charm++ chares created by
     Transporter. Each ALECG gets a chunk of the full load (part of the mesh)
@@ -103,16 +104,17 @@ class ALECG : public CBase_ALECG {
     //! Advance equations to next time step
     void advance( tk::real newdt );
 
+    //! Continue with next time step stage
+    void stage();
+
     //! Compute left-hand side of transport equations
     void lhs();
 
     //! Receive contributions to left-hand side matrix on chare-boundaries
-    void comlhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& L );
+    void comlhs( int fromch, const std::vector< tk::real >& L );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R );
+    void comrhs( int fromch, const std::vector< tk::real >& R );
 
     //! Update solution at the end of time step
     void update( const tk::Fields& a );
@@ -145,6 +147,9 @@ class ALECG : public CBase_ALECG {
     //! Evaluate whether to continue with next time step
     void step();
 
+    //! Evaluate whether to do load balancing, then continue with next step
+    void evalLB();
+
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
     //! \brief Pack/Unpack serialize member function
@@ -155,9 +160,10 @@ class ALECG : public CBase_ALECG {
       p | m_nsol;
       p | m_nlhs;
       p | m_nrhs;
+      p | m_stage;
       p | m_bnode;
       p | m_u;
-      p | m_du;
+      p | m_un;
       p | m_lhs;
       p | m_rhs;
       p | m_lhsc;
@@ -184,12 +190,14 @@ class ALECG : public CBase_ALECG {
     std::size_t m_nlhs;
     //! Counter for right-hand side vector nodes updated
     std::size_t m_nrhs;
+    //! Runge-Kutta stage counter
+    std::size_t m_stage;
     //! Boundary node lists mapped to side set ids
     std::map< int, std::vector< std::size_t > > m_bnode;
     //! Unknown/solution vector at mesh nodes
     tk::Fields m_u;
-    //! Unknown/solution vector increment (high order)
-    tk::Fields m_du;
+    //! Unknown/solution vector at mesh nodes at previous time step
+    tk::Fields m_un;
     //! Lumped lhs mass matrix
     tk::Fields m_lhs;
     //! Right-hand side vector (for the high order system)
@@ -228,7 +236,7 @@ class ALECG : public CBase_ALECG {
     //! Start time stepping
     void start();
 
-    //! Solve low and high order diagonal systems
+    //! Solve diagonal system and advance Runge-Kutta stage
     void solve();
 
     //! Compute time step size
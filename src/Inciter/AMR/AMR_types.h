@@ -4,9 +4,11 @@
 #include <array>
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 #include "../Base/Types.h"
 #include "edge.h"
+#include "flat_map.h"
 #include "UnsMesh.h"
 
 // TODO: Do we need to merge this with Base/Types.h?
@@ -98,9 +100,15 @@ struct Edge_Refinement {
     }
 };
 
+//! Hash function class for edges, reusing the one for element primitives
+struct Edge_Hash {
+    std::size_t operator()( const edge_t& e ) const
+    { return tk::UnsMesh::Hash<2>()( e.get_data() ); }
+};
+
 // Complex types
 struct Edge_Refinement; // forward declare
-using edges_t = std::map<edge_t, Edge_Refinement>;
+using edges_t = flat_map<edge_t, Edge_Refinement, Edge_Hash>;
 using edge_list_t  = std::array<edge_t, NUM_TET_EDGES>;
 using edge_list_ids_t  = std::array<std::size_t, NUM_TET_EDGES>;
 
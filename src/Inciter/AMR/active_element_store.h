@@ -1,17 +1,17 @@
 #ifndef AMR_active_element_store_h
 #define AMR_active_element_store_h
 
-#include <set>
+#include <unordered_set>
 
 namespace AMR {
 
     class active_element_store_t {
         private:
-            std::set<size_t> active_elements;
+            std::unordered_set<size_t> active_elements;
         public:
 
             //! Non-const-ref access to state
-            std::set<size_t>& data() { return active_elements; }
+            std::unordered_set<size_t>& data() { return active_elements; }
 
             /**
              * @brief Function to add active elements
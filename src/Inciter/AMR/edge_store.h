@@ -10,7 +10,10 @@ namespace AMR {
 
     class edge_store_t {
         public:
-            // TODO: convert this to an unordered map with a custom hash (can lift from Quinoa)
+            // Hashed by the node ids, see Edge_Hash, and stored contiguously,
+            // see flat_map. Passes over all edges must not depend on the order
+            // of iteration, and must not hold references to edges across
+            // adding or erasing edges.
             edges_t edges;
 
             // Node connectivity does this any way, but in a slightly less efficient way
@@ -74,13 +77,9 @@ namespace AMR {
                 add(keyAB, edgeAB);
             }
 
-            bool exists(edge_t key)
+            bool exists(const edge_t& key) const
             {
-                if (edges.find(key) != edges.end())
-                {
-                    return true;
-                }
-                return false;
+                return edges.find(key) != edges.end();
             }
 
             /**
@@ -90,12 +89,12 @@ namespace AMR {
              *
              * @return A reference to the fetched edge
              */
-            Edge_Refinement& get(edge_t key)
+            Edge_Refinement& get(const edge_t& key)
             {
                 //trace_out << "get edge " << key << std::endl;
-                // cppcheck-suppress assertWithSideEffect
-                assert( exists(key) );
-                return edges[key];
+                auto it = edges.find(key);
+                assert( it != edges.end() );
+                return it->second;
             }
 
             Edge_Lock_Case lock_case(const edge_t& key)
@@ -103,7 +102,7 @@ namespace AMR {
                 return get(key).lock_case;
             }
 
-            void erase(edge_t key)
+            void erase(const edge_t& key)
             {
                 edges.erase(key);
             }
@@ -0,0 +1,254 @@
+#ifndef AMR_flat_map_h
+#define AMR_flat_map_h
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cassert>
+#include <functional>
+
+namespace AMR {
+
+    /**
+     * @brief Hash map with contiguous storage, used by the AMR stores
+     *
+     * The entries are stored contiguously in a vector, in which they are
+     * iterated, and are found via an open-addressing (linear probing) table
+     * of indices into the entries, whose size is a power of two at least
+     * twice the number of entries. Erasing an entry moves the last entry in
+     * its place and removes its index from the table by shifting back the
+     * indices following it, so the table never holds deleted markers.
+     *
+     * Unlike in std::unordered_map, keys are not const (they must not be
+     * modified through iterators), iteration order changes on erase, and
+     * inserting or erasing an entry invalidates references and iterators to
+     * all entries.
+     *
+     * @tparam Key Key type
+     * @tparam T Mapped type
+     * @tparam Hash Hash function class of keys
+     * @tparam KeyEqual Equality comparison function class of keys
+     */
+    template< class Key, class T, class Hash = std::hash< Key >,
+              class KeyEqual = std::equal_to< Key > >
+    class flat_map {
+        public:
+            using key_type = Key;
+            using mapped_type = T;
+            using value_type = std::pair< Key, T >;
+            using iterator = typename std::vector< value_type >::iterator;
+            using const_iterator =
+              typename std::vector< value_type >::const_iterator;
+
+            // Iteration over the contiguous entries
+            iterator begin() { return entries.begin(); }
+            iterator end() { return entries.end(); }
+            const_iterator begin() const { return entries.begin(); }
+            const_iterator end() const { return entries.end(); }
+
+            std::size_t size() const { return entries.size(); }
+            bool empty() const { return entries.empty(); }
+
+            void clear()
+            {
+                entries.clear();
+                table.clear();
+            }
+
+            /**
+             * @brief Reserve storage so that n entries can be inserted without
+             * rehashing
+             *
+             * @param n Number of entries to reserve storage for
+             */
+            void reserve(std::size_t n)
+            {
+                entries.reserve(n);
+                if (2*n > table.size()) rehash(2*n);
+            }
+
+            iterator find(const Key& key)
+            {
+                auto s = slot(key);
+                if (s == npos) return entries.end();
+                return entries.begin() + static_cast< long >( table[s] );
+            }
+
+            const_iterator find(const Key& key) const
+            {
+                auto s = slot(key);
+                if (s == npos) return entries.end();
+                return entries.begin() + static_cast< long >( table[s] );
+            }
+
+            std::size_t count(const Key& key) const
+            {
+                return slot(key) == npos ? 0 : 1;
+            }
+
+            T& at(const Key& key)
+            {
+                auto s = slot(key);
+                assert( s != npos );
+                return entries[ table[s] ].second;
+            }
+
+            const T& at(const Key& key) const
+            {
+                auto s = slot(key);
+                assert( s != npos );
+                return entries[ table[s] ].second;
+            }
+
+            /**
+             * @brief Insert an entry if its key does not exist
+             *
+             * @param v Entry to insert
+             *
+             * @return Iterator to the entry with the key and a bool stating if
+             * the entry was inserted
+             */
+            std::pair< iterator, bool > insert(const value_type& v)
+            {
+                if (2*(entries.size()+1) > table.size())
+                    rehash(2*(entries.size()+1));
+
+                auto mask = table.size()-1;
+                auto s = home(v.first);
+                while (table[s] != npos)
+                {
+                    if (KeyEqual()(entries[ table[s] ].first, v.first))
+                    {
+                        return { entries.begin() +
+                                 static_cast< long >( table[s] ), false };
+                    }
+                    s = (s+1) & mask;
+                }
+
+                table[s] = entries.size();
+                entries.push_back(v);
+                return { entries.end()-1, true };
+            }
+
+            T& operator[](const Key& key)
+            {
+                return insert( value_type(key, T()) ).first->second;
+            }
+
+            /**
+             * @brief Erase the entry with a key, if it exists
+             *
+             * @param key Key of the entry to erase
+             *
+             * @return Number of entries erased
+             */
+            std::size_t erase(const Key& key)
+            {
+                auto s = slot(key);
+                if (s == npos) return 0;
+
+                // Move the last entry in place of the erased one
+                auto i = table[s];
+                auto last = entries.size()-1;
+                if (i != last)
+                {
+                    table[ slot( entries[last].first ) ] = i;
+                    entries[i] = std::move( entries[last] );
+                }
+                entries.pop_back();
+
+                // Shift back the indices following the erased one whose
+                // probe sequence passes through its slot
+                auto mask = table.size()-1;
+                auto hole = s;
+                auto n = (hole+1) & mask;
+                while (table[n] != npos)
+                {
+                    auto h = home( entries[ table[n] ].first );
+                    if (((n - h) & mask) >= ((n - hole) & mask))
+                    {
+                        table[hole] = table[n];
+                        hole = n;
+                    }
+                    n = (n+1) & mask;
+                }
+                table[hole] = npos;
+
+                return 1;
+            }
+
+        private:
+            //! Marker of empty slots
+            static constexpr std::size_t npos = ~std::size_t(0);
+
+            //! Entries stored contiguously
+            std::vector< value_type > entries;
+            //! Open-addressing table of indices into entries
+            std::vector< std::size_t > table;
+            //! 64 minus the base-2 logarithm of the table size
+            unsigned shift = 60;
+
+            /**
+             * @brief Compute the slot at which the probe sequence of a key
+             * starts
+             *
+             * @param key Key to compute the slot of
+             *
+             * @return Slot given by the high bits of the hash multiplied by
+             * 2^64 divided by the golden ratio, which spreads consecutive
+             * keys, e.g., tet ids hashed by std::hash, across the table
+             */
+            std::size_t home(const Key& key) const
+            {
+                return static_cast< std::size_t >(
+                  (static_cast< unsigned long long >( Hash()(key) ) *
+                   11400714819323198485ULL) >> shift );
+            }
+
+            /**
+             * @brief Find the slot of a key in the table
+             *
+             * @param key Key to find
+             *
+             * @return Slot of the key, npos if the key does not exist
+             */
+            std::size_t slot(const Key& key) const
+            {
+                if (table.empty()) return npos;
+                auto mask = table.size()-1;
+                auto s = home(key);
+                while (table[s] != npos)
+                {
+                    if (KeyEqual()(entries[ table[s] ].first, key)) return s;
+                    s = (s+1) & mask;
+                }
+                return npos;
+            }
+
+            /**
+             * @brief Rebuild the table with at least n slots
+             *
+             * @param n Minimum number of slots
+             */
+            void rehash(std::size_t n)
+            {
+                std::size_t m = 16;
+                shift = 60;
+                while (m < n) { m *= 2; --shift; }
+                table.assign(m, npos);
+                auto mask = m-1;
+                for (std::size_t i=0; i<entries.size(); ++i)
+                {
+                    auto s = home(entries[i].first);
+                    while (table[s] != npos) s = (s+1) & mask;
+                    table[s] = i;
+                }
+            }
+    };
+
+    template< class Key, class T, class Hash, class KeyEqual >
+    constexpr std::size_t flat_map< Key, T, Hash, KeyEqual >::npos;
+
+}  // AMR::
+
+#endif // AMR_flat_map_h
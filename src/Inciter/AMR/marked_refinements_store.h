@@ -1,14 +1,14 @@
 #ifndef AMR_marked_refinements_store_h
 #define AMR_marked_refinements_store_h
 
-#include <map>
 #include "Refinement_State.h"
+#include "flat_map.h"
 
 namespace AMR {
 
     class marked_refinements_store_t {
         private:
-            std::map<size_t, Refinement_Case> marked_refinements;
+            flat_map<size_t, Refinement_Case> marked_refinements;
 
             // TODO: This probably isn't the right place for this
             // We will use this variable to check if anything has changed
@@ -18,7 +18,7 @@ namespace AMR {
         public:
             //! Non-const-ref access to state
             //! \return Map of marked refinements
-            std::map<size_t, Refinement_Case>& data() {
+            flat_map<size_t, Refinement_Case>& data() {
               return marked_refinements;
             }
 
@@ -70,14 +70,15 @@ namespace AMR {
             void add(size_t id, Refinement_Case r)
             {
                 // Check if that active element already exists
-                if (exists(id))
+                auto f = marked_refinements.find(id);
+                if (f != marked_refinements.end())
                 {
-                    if (marked_refinements[id] != r)
+                    if (f->second != r)
                     {
                         trace_out << "Updating marked value to " << r <<
-                            " was " << marked_refinements[id] << std::endl;
+                            " was " << f->second << std::endl;
 
-                        marked_refinements[id] = r;
+                        f->second = r;
 
                         // TODO :Find a better way to handle/update this global
                         refinement_state_changed = true;
@@ -109,9 +110,8 @@ namespace AMR {
             void replace(size_t old_id, size_t new_id)
             {
                 // Swap id out in map
-                auto i = marked_refinements.find(old_id);
-                auto value = i->second;
-                marked_refinements.erase(i);
+                auto value = marked_refinements.at(old_id);
+                marked_refinements.erase(old_id);
                 marked_refinements[new_id] = value;
             }
     };
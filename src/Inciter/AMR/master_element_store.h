@@ -1,20 +1,22 @@
 #ifndef AMR_master_element_store_h
 #define AMR_master_element_store_h
 
-#include <map>
 #include <algorithm>
 
 #include "Refinement_State.h"
+#include "flat_map.h"
 #include "AMR/Loggers.h"                   // for trace_out
 
 namespace AMR {
 
     class master_element_store_t {
         private:
-            std::map<size_t, Refinement_State> master_elements;
+            // Stored contiguously, see flat_map: references to elements are
+            // invalidated by adding or erasing elements
+            flat_map<size_t, Refinement_State> master_elements;
         public:
             //! Non-const-ref access to state
-            std::map<size_t, Refinement_State>& data() {
+            flat_map<size_t, Refinement_State>& data() {
               return master_elements;
             }
 
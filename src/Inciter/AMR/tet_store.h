@@ -20,13 +20,13 @@ namespace AMR {
                 // This is a horrendous code abuse, and I'm sorry. I'm fairly
                 // certain we'll be re-writing how this detection is done and just
                 // wanted a quick-fix so I could move on :(
-            std::set<size_t> center_tets; // Store for 1:4 centers
+            std::unordered_set<size_t> center_tets; // Store for 1:4 centers
 
             AMR::active_element_store_t active_elements;
             AMR::master_element_store_t master_elements;
 
             std::vector< std::size_t > active_tetinpoel;
-            std::set< std::size_t > active_nodes;
+            std::unordered_set< std::size_t > active_nodes;
 
             AMR::id_generator_t id_generator;
 
@@ -0,0 +1,106 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/CommPlan.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Communication plan for exchanging data on chare-boundary nodes
+  \details   Communication plan for exchanging data on mesh nodes shared
+    among chares. The plan is built once for a mesh (and rebuilt after mesh
+    refinement) so that subsequent exchanges can ship a single contiguous
+    array of reals per fellow chare, without global node IDs, and the receiver
+    can scatter the data using precomputed indices instead of hash lookups.
+*/
+// *****************************************************************************
+#ifndef CommPlan_h
+#define CommPlan_h
+
+#include <vector>
+#include <unordered_map>
+
+#include "Types.h"
+#include "Fields.h"
+#include "ContainerUtil.h"
+#include "PUPUtil.h"
+
+namespace inciter {
+
+//! Communication plan for exchanging data on chare-boundary nodes
+//! \details The nodes shared with a fellow chare are ordered by their global
+//!   IDs. Since both chares sharing nodes store the same set of global IDs,
+//!   they agree on this order without communication: a message sent by one
+//!   chare is a flat array of rows ordered the same way, thus the receiver
+//!   finds the row for each node at its position in the message.
+class CommPlan {
+
+  public:
+    //! Empty constructor for Charm++
+    CommPlan() = default;
+
+    //! Constructor
+    explicit CommPlan(
+      const std::unordered_map< int, std::vector< std::size_t > >& msum,
+      const std::unordered_map< std::size_t, std::size_t >& bid,
+      const std::unordered_map< std::size_t, std::size_t >& lid );
+
+    //! Local node IDs of the nodes shared with a fellow chare in agreed order
+    //! \param[in] c Fellow chare ID
+    //! \return Local node IDs of the nodes shared with chare c
+    const std::vector< std::size_t >& Lid( int c ) const
+    { return tk::cref_find( m_lid, c ); }
+
+    //! \brief Receive buffer indices of the nodes shared with a fellow chare
+    //!   in agreed order
+    //! \param[in] c Fellow chare ID
+    //! \return Receive buffer indices, i.e., local chare-boundary node IDs, of
+    //!   the nodes shared with chare c
+    const std::vector< std::size_t >& Bid( int c ) const
+    { return tk::cref_find( m_bid, c ); }
+
+    //! Pack data at the nodes shared with a fellow chare into a flat array
+    std::vector< tk::real > pack( int c, const tk::Fields& u ) const;
+
+    //! \brief Append data at the nodes shared with a fellow chare to a flat
+    //!   array, e.g., to aggregate multiple fields into a single message
+    void pack( int c, const tk::Fields& u, std::vector< tk::real >& s ) const;
+
+    //! Pack a scalar at the nodes shared with a fellow chare into an array
+    std::vector< tk::real > pack( int c, const std::vector< tk::real >& u )
+    const;
+
+    //! Add data received from a fellow chare to a receive buffer
+    void add( int c,
+              const std::vector< tk::real >& r,
+              std::vector< std::vector< tk::real > >& b ) const;
+
+    //! Add a block of data received from a fellow chare to a receive buffer
+    void add( int c,
+              const tk::real* r,
+              std::size_t n,
+              std::vector< std::vector< tk::real > >& b ) const;
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_lid;
+      p | m_bid;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c CommPlan object reference
+    friend void operator|( PUP::er& p, CommPlan& c ) { c.pup(p); }
+    //@}
+
+  private:
+    //! Local node IDs of shared nodes associated to fellow chare IDs
+    std::unordered_map< int, std::vector< std::size_t > > m_lid;
+    //! Receive buffer indices of shared nodes associated to fellow chare IDs
+    std::unordered_map< int, std::vector< std::size_t > > m_bid;
+};
+
+} // inciter::
+
+#endif // CommPlan_h
@@ -32,6 +32,7 @@
 #include "DerivedData.h"
 #include "FaceData.h"
 #include "ElemDiagnostics.h"
+#include "Timer.h"
 
 #include "NoWarning/dg.decl.h"
 
@@ -112,19 +113,16 @@ class DG : public CBase_DG {
     void sendinit();
 
     //! Receive chare-boundary ghost data from neighboring chares
-    void cominit( int fromch,
-                  const std::vector< std::size_t >& tetid,
-                  const std::vector< std::vector< tk::real > >& u );
+    void cominit( int fromch, std::size_t n, const tk::real* u );
 
     //! Receive chare-boundary limiter function data from neighboring chares
-    void comlim( int fromch,
-                 const std::vector< std::size_t >& tetid,
-                 const std::vector< std::vector< tk::real > >& lfn );
+    void comlim( int fromch, std::size_t n, const tk::real* lfn );
 
     //! Receive chare-boundary ghost data from neighboring chares
-    void comsol( int fromch,
-                 const std::vector< std::size_t >& tetid,
-                 const std::vector< std::vector< tk::real > >& u );
+    void comsol( int fromch, std::size_t n, const tk::real* u );
+
+    //! Receive local time stepping levels of ghost elements
+    void comlevel( int fromch, std::size_t n, const tk::real* l );
 
     //! Advance equations to next time step
     void advance( tk::real );
@@ -165,11 +163,14 @@ class DG : public CBase_DG {
     void resized();
 
     //! Compute right hand side and solve system
-    void solve( tk::real newdt );
+    void solve( tk::real* d, int n );
 
     //! Evaluate whether to continue with next time step
     void step();
 
+    //! Evaluate whether to do load balancing, then continue with next step
+    void evalLB();
+
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
     //! \brief Pack/Unpack serialize member function
@@ -186,6 +187,8 @@ class DG : public CBase_DG {
       p | m_un;
       p | m_geoFace;
       p | m_geoElem;
+      p | m_geoFaceGp;
+      p | m_geoElemGp;
       p | m_lhs;
       p | m_rhs;
       p | m_limFunc;
@@ -198,6 +201,26 @@ class DG : public CBase_DG {
       p | m_ghostData;
       p | m_ghostReq;
       p | m_ghost;
+      p | m_ghostSend;
+      p | m_ghostRecv;
+      p | m_ghostBytes;
+      p | m_ghostTime;
+      p | m_ghostStages;
+      p | m_ghostTimer;
+      p | m_nlevel;
+      p | m_ltsSub;
+      p | m_ltsLevel;
+      p | m_ltsAcc;
+      p | m_ltsCorr;
+      p | m_ltsCorrect;
+      p | m_ltsRefine;
+      p | m_dte;
+      p | m_fw;
+      p | m_ew;
+      p | m_cw;
+      p | m_ndofel;
+      p | m_ndofNext;
+      p | m_pref;
       p | m_exptGhost;
       p | m_recvGhost;
       p | m_diag;
@@ -245,6 +268,12 @@ class DG : public CBase_DG {
     tk::Fields m_geoFace;
     //! Element geometry
     tk::Fields m_geoElem;
+    //! \brief Face quadrature-point data, see tk::genGeoFaceGp()
+    //! \details Only computed if configured by the user, otherwise empty
+    tk::Fields m_geoFaceGp;
+    //! \brief Element quadrature-point data, see tk::genGeoElemGp()
+    //! \details Only computed if configured by the user, otherwise empty
+    tk::Fields m_geoElemGp;
     //! Left-hand side mass-matrix which is a diagonal matrix
     tk::Fields m_lhs;
     //! Vector of right-hand side
@@ -280,6 +309,59 @@ class DG : public CBase_DG {
     //!    chare id (outer map key) this remote element lies in.
     std::unordered_map< int,
       std::unordered_map< std::size_t, std::size_t > > m_ghost;
+    //! Local ids of our tets whose data is sent to fellow chares as ghost data
+    //! \details The ids are in ascending order, which is the order in which
+    //!   the rows of the per-neighbor buffers are packed in packGhost().
+    std::unordered_map< int, std::vector< std::size_t > > m_ghostSend;
+    //! Local ids of ghost tets in the order their data arrives from each chare
+    //! \details This is the order of m_ghostSend on the sending chare, obtained
+    //!   by sorting the remote ids in m_ghost, so no ids need to be sent along
+    //!   with the ghost data.
+    std::unordered_map< int, std::vector< std::size_t > > m_ghostRecv;
+    //! Bytes of ghost data sent since the last diagnostics
+    tk::real m_ghostBytes;
+    //! Wall-clock time spent on ghost exchanges since the last diagnostics
+    tk::real m_ghostTime;
+    //! Number of Runge-Kutta stages since the last diagnostics
+    std::size_t m_ghostStages;
+    //! Timer measuring a single ghost exchange, from packing to unpacking
+    tk::Timer m_ghostTimer;
+    //! Counter signaling that we have received all local time stepping levels
+    std::size_t m_nlevel;
+    //! Time step within a cycle of local time stepping
+    //! \details A cycle consists of 2^(L-1) time steps with L levels. Levels
+    //!   are only assigned at the beginning of a cycle, and all elements are
+    //!   at the same time at the end of a cycle.
+    std::size_t m_ltsSub;
+    //! Local time stepping level of elements (including ghosts)
+    tk::Fields m_ltsLevel;
+    //! \brief Pending solution increments accumulated from faces shared with
+    //!   finer elements during the local time step of an element
+    tk::Fields m_ltsAcc;
+    //! Right-hand side of faces integrated with the correction weights
+    tk::Fields m_ltsCorr;
+    //! True if any of the correction weights is nonzero in this time step
+    bool m_ltsCorrect;
+    //! True if mesh refinement is deferred to the end of the cycle
+    bool m_ltsRefine;
+    //! Stable time step size of each element
+    std::vector< tk::real > m_dte;
+    //! Face weights, two per face, for the left and right element
+    std::vector< tk::real > m_fw;
+    //! Element weights: time step size of elements advanced in this time step
+    std::vector< tk::real > m_ew;
+    //! \brief Correction weights, two per face, of faces between elements on
+    //!   different levels advanced in this time step
+    std::vector< tk::real > m_cw;
+    //! Number of degrees of freedom active on elements (including ghosts)
+    //! \details Empty if p-adaptivity is off. Ghost elements are integrated
+    //!   with all degrees of freedom, since their owners zero the inactive
+    //!   ones before sending them.
+    std::vector< std::size_t > m_ndofel;
+    //! Number of degrees of freedom selected for our elements for next step
+    std::vector< std::size_t > m_ndofNext;
+    //! Reference magnitudes of scalar components for p-adaptivity
+    std::vector< tk::real > m_pref;
     //! Expected ghost tet ids (used only in DEBUG)
     std::set< std::size_t > m_exptGhost;
     //! Received ghost tet ids (used only in DEBUG)
@@ -331,6 +413,40 @@ class DG : public CBase_DG {
     //! Continue after face adjacency communication map completed on this chare
     void adj();
 
+    //! Agree on the order of ghost data exchanged with fellow chares
+    void ghostOrder();
+
+    //! Compute right-hand side and advance Runge-Kutta stage
+    void rk();
+
+    //! Number of local time stepping levels in effect
+    std::size_t ltsLevels() const;
+
+    //! Assign local time stepping levels and send them to fellow chares
+    void ltsLevel();
+
+    //! Compute element, face, and correction weights for local time stepping
+    void ltsWeights();
+
+    //! Advance Runge-Kutta stage of elements due or accumulate increments
+    void ltsUpdate();
+
+    //! Apply accumulated increments of elements whose local time step completes
+    void ltsAdvance();
+
+    //! Select number of degrees of freedom of elements for p-adaptivity
+    void selectNdof();
+
+    //! Project solution of elements onto their newly selected polynomial degree
+    void applyNdof();
+
+    //! Pack rows of our tets adjacent to a fellow chare into a flat buffer
+    std::vector< tk::real > packGhost( int c, const tk::Fields& f ) const;
+
+    //! Unpack a flat buffer of ghost data received from a fellow chare
+    void unpackGhost( int c, std::size_t n, const tk::real* buf,
+                      tk::Fields& f ) const;
+
     //! Fill elements surrounding a face along chare boundary
     void addEsuf( const std::array< std::size_t, 2 >& id, std::size_t ghostid );
 
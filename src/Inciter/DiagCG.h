@@ -28,6 +28,7 @@
 #ifndef DiagCG_h
 #define DiagCG_h
 
+#include <array>
 #include <vector>
 #include <map>
 #include <unordered_set>
@@ -36,6 +37,7 @@
 #include "Types.h"
 #include "Fields.h"
 #include "DerivedData.h"
+#include "ThreadPool.h"
 #include "FluxCorrector.h"
 #include "NodeDiagnostics.h"
 #include "Inciter/InputDeck/InputDeck.h"
@@ -112,16 +114,10 @@ class DiagCG : public CBase_DiagCG {
     void lhs();
 
     //! Receive contributions to left-hand side matrix on chare-boundaries
-    void comlhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& L );
+    void comlhs( int fromch, const std::vector< tk::real >& L );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R );
-
-    //!  Receive contributions to RHS mass diffusion on chare-boundaries
-    void comdif( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& D );
+    void comrhs( int fromch, const std::vector< tk::real >& R );
 
     //! Update solution at the end of time step
     void update( const tk::Fields& a );
@@ -154,6 +150,9 @@ class DiagCG : public CBase_DiagCG {
     //! Evaluate whether to continue with next time step
     void step();
 
+    //! Evaluate whether to do load balancing, then continue with next step
+    void evalLB();
+
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
     //! \brief Pack/Unpack serialize member function
@@ -164,7 +163,6 @@ class DiagCG : public CBase_DiagCG {
       p | m_nsol;
       p | m_nlhs;
       p | m_nrhs;
-      p | m_ndif;
       p | m_bnode;
       p | m_u;
       p | m_ul;
@@ -178,8 +176,14 @@ class DiagCG : public CBase_DiagCG {
       p | m_lhsc;
       p | m_rhsc;
       p | m_difc;
+      p | m_bndel;
+      p | m_intel;
+      p | m_bndch;
+      p | m_intch;
       p | m_vol;
       p | m_diag;
+      p | m_comm;
+      p | m_ncomm;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -200,8 +204,6 @@ class DiagCG : public CBase_DiagCG {
     std::size_t m_nlhs;
     //! Counter for right-hand side vector nodes updated
     std::size_t m_nrhs;
-    //! Counter for right-hand side masss-diffusion vector nodes updated
-    std::size_t m_ndif;
     //! Boundary node lists mapped to side set ids
     std::map< int, std::vector< std::size_t > > m_bnode;
     //! Unknown/solution vector at mesh nodes
@@ -230,10 +232,25 @@ class DiagCG : public CBase_DiagCG {
       std::vector< std::pair< bool, tk::real > > > m_bc;
     //! Receive buffers for communication
     std::vector< std::vector< tk::real > > m_lhsc, m_rhsc, m_difc;
+    //! Ids of elements with at least one chare-boundary node
+    std::vector< std::size_t > m_bndel;
+    //! Ids of elements with no chare-boundary node
+    std::vector< std::size_t > m_intel;
+    //! \brief Chare-boundary elements grouped by color and split into chunks
+    //!   for multithreaded rhs computation, empty if running single-threaded
+    tk::ColoredChunks m_bndch;
+    //! \brief Interior elements grouped by color and split into chunks for
+    //!   multithreaded rhs computation, empty if running single-threaded
+    tk::ColoredChunks m_intch;
     //! Total mesh volume
     tk::real m_vol;
     //! Diagnostics object
     NodeDiagnostics m_diag;
+    //! \brief Number of messages and bytes sent to fellow chares since
+    //!   diagnostics were last computed
+    std::array< tk::real, 2 > m_comm;
+    //! Number of time steps m_comm has been accumulated over
+    std::size_t m_ncomm;
 
     //! Access bound Discretization class pointer
     Discretization* Disc() const {
@@ -244,6 +261,14 @@ class DiagCG : public CBase_DiagCG {
     //! Size communication buffers
     void resizeComm();
 
+    //! Split elements into chare-boundary and interior sets
+    void splitElems();
+
+    //! \brief Compute right-hand side and mass diffusion rhs contributions of
+    //!   a set of elements
+    void elemRhs( const std::vector< std::size_t >& elem,
+                  const tk::ColoredChunks& chunks );
+
     //! Output mesh fields to files
     void out();
 
@@ -20,6 +20,7 @@
 #include "PUPUtil.h"
 #include "PDFReducer.h"
 #include "UnsMesh.h"
+#include "CommPlan.h"
 
 #include "NoWarning/discretization.decl.h"
 #include "NoWarning/refiner.decl.h"
@@ -69,8 +70,7 @@ class Discretization : public CBase_Discretization {
     void setRefiner( const CProxy_Refiner& ref );
 
     //! Collect nodal volumes across chare boundaries
-    void comvol( const std::vector< std::size_t >& gid,
-                 const std::vector< tk::real >& nodevol );
+    void comvol( int fromch, const std::vector< tk::real >& nodevol );
 
     //! Sum mesh volumes and contribute own mesh volume to total volume
     void totalvol();
@@ -165,6 +165,25 @@ class Discretization : public CBase_Discretization {
     std::unordered_map< int, std::vector< std::size_t > >& Msum()
     { return m_msum; }
 
+    //! Nodal communication plan accessor as const-ref
+    const CommPlan& Plan() const { return m_plan; }
+
+    //! Element Jacobians and shape function gradients accessor as const-ref
+    //! \see tk::genGeoElemGrad()
+    const tk::Fields& GeoElemGrad() const { return m_geoElemGrad; }
+
+    //! Edge connectivity accessor as const-ref
+    //! \see tk::genInpoed()
+    const std::vector< std::size_t >& Inpoed() const { return m_inpoed; }
+
+    //! Edge coefficients of the edge-based assembly accessor as const-ref
+    //! \see tk::genEdgeCoef()
+    const tk::Fields& EdgeCoef() const { return m_edgeCoef; }
+
+    //! Node coefficients of the edge-based assembly accessor as const-ref
+    //! \see tk::genNodeCoef()
+    const tk::Fields& NodeCoef() const { return m_nodeCoef; }
+
     //! Points surrounding points accessor as const-ref
     const std::pair< std::vector< std::size_t >, std::vector< std::size_t > >&
     Psup() const { return m_psup; }
@@ -229,6 +248,11 @@ class Discretization : public CBase_Discretization {
       p | m_vol;
       p | m_volc;
       p | m_bid;
+      p | m_plan;
+      p | m_geoElemGrad;
+      p | m_inpoed;
+      p | m_edgeCoef;
+      p | m_nodeCoef;
       p | m_timer;
       p | m_refined;
     }
@@ -313,6 +337,22 @@ class Discretization : public CBase_Discretization {
     //!   contributions associated to global mesh node IDs of mesh elements we
     //!   contribute to
     std::unordered_map< std::size_t, std::size_t > m_bid;
+    //! \brief Communication plan for exchanging data on chare-boundary nodes,
+    //!   rebuilt when the mesh changes
+    CommPlan m_plan;
+    //! Element Jacobians and shape function gradients, see tk::genGeoElemGrad()
+    //! \details Only generated for the node-centered (CG) schemes, whose PDEs
+    //!   and flux-corrected transport read them in each time step instead of
+    //!   recomputing them from the coordinates. Empty for DG.
+    tk::Fields m_geoElemGrad;
+    //! Edge connectivity, see tk::genInpoed()
+    //! \details Only generated for the schemes using edge-based assembly
+    //!   (ALECG), empty otherwise, as are m_edgeCoef and m_nodeCoef.
+    std::vector< std::size_t > m_inpoed;
+    //! Edge coefficients of the edge-based assembly, see tk::genEdgeCoef()
+    tk::Fields m_edgeCoef;
+    //! Node coefficients of the edge-based assembly, see tk::genNodeCoef()
+    tk::Fields m_nodeCoef;
     //! Timer measuring a time step
     tk::Timer m_timer;
     //! 1 if mesh was refined in a time step, 0 if it was not
@@ -320,6 +360,9 @@ class Discretization : public CBase_Discretization {
 
     //! Set mesh coordinates based on coordinates map
     tk::UnsMesh::Coords setCoord( const tk::UnsMesh::CoordMap& coordmap );
+
+    //! Generate edge connectivity and coefficients for edge-based assembly
+    void genEdgeData();
 };
 
 } // inciter::
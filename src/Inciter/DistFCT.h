@@ -25,6 +25,7 @@
 #ifndef DistFCT_h
 #define DistFCT_h
 
+#include <array>
 #include <cstddef>
 #include <iosfwd>
 #include <utility>
@@ -40,6 +41,7 @@
 #include "Fields.h"
 #include "DerivedData.h"
 #include "FluxCorrector.h"
+#include "CommPlan.h"
 #include "Discretization.h"
 #include "DiagCG.h"
 #include "Inciter/InputDeck/InputDeck.h"
@@ -100,32 +102,43 @@ class DistFCT : public CBase_DistFCT {
     tk::Fields lump( const Discretization& d );
 
     //! \brief Compute mass diffusion rhs contribution required for the low
-    //!   order solution
-    tk::Fields diff( const Discretization& d, const tk::Fields& Un );
+    //!   order solution and antidiffusive element contributions
+    void diff( const Discretization& d,
+               const std::vector< std::size_t >& elem,
+               const tk::Fields& Un,
+               const std::unordered_map< std::size_t,
+                       std::vector< std::pair< bool, tk::real > > >& bc,
+               tk::Fields& D );
 
     //! Prepare for next time step stage
     void next();
 
     //! Receive sums of antidiffusive element contributions on chare-boundaries
-    void comaec( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& P );
+    void comaec( int fromch, const std::vector< tk::real >& P );
+
+    //! \brief Append sums of antidiffusive element contributions on nodes
+    //!   shared with a fellow chare to a message the host sends
+    void packaec( int c, std::vector< tk::real >& s ) const;
+
+    //! \brief Add sums of antidiffusive element contributions received from a
+    //!   fellow chare as part of a message the host received
+    void addaec( int fromch, const tk::real* P, std::size_t n );
+
+    //! \brief Query and reset the number of messages and bytes sent to fellow
+    //!   chares since the last query
+    std::array< tk::real, 2 > sent();
 
     //! \brief Receive contributions to the maxima and minima of unknowns of all
     //!   elements surrounding mesh nodes on chare-boundaries
-    void comalw( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& Q );
+    void comalw( int fromch, const std::vector< tk::real >& Q );
 
     //! \brief Receive contributions of limited antidiffusive element
     //!   contributions on chare-boundaries
-    void comlim( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& A );
+    void comlim( int fromch, const std::vector< tk::real >& A );
 
-    //! Compute and sum antidiffusive element contributions (AEC) to mesh nodes
-    void aec( const Discretization& d,
-              const tk::Fields& dUh,
-              const tk::Fields& Un,
-              const std::unordered_map< std::size_t,
-                      std::vector< std::pair< bool, tk::real > > >& bc );
+    //! \brief Start communicating the sums of antidiffusive element
+    //!   contributions (AEC) to mesh nodes
+    void aec( const tk::Fields& dUh );
 
     //! \brief Compute the maximum and minimum unknowns of all elements
     //!   surrounding nodes
@@ -151,9 +164,12 @@ class DistFCT : public CBase_DistFCT {
       p | m_nalw;
       p | m_nlim;
       p | m_nchare;
+      p | m_agg;
+      p | m_sent;
       p | m_msum;
       p | m_bid;
       p | m_lid;
+      p | m_plan;
       p | m_inpoel;
       p | m_fluxcorrector;
       p | m_p;
@@ -187,6 +203,11 @@ class DistFCT : public CBase_DistFCT {
     std::size_t m_nlim;
     //! Total number of worker chares
     std::size_t m_nchare;
+    //! \brief True if the sums of antidiffusive element contributions are
+    //!   sent by the host as part of its right hand side message
+    bool m_agg;
+    //! Number of messages and bytes sent to fellow chares since last queried
+    std::array< tk::real, 2 > m_sent;
     //! \brief Global mesh node IDs bordering the mesh chunk held by fellow
     //!   chares associated to their chare IDs
     //! \details msum: mesh chunks surrounding mesh chunks and their neighbor
@@ -201,6 +222,8 @@ class DistFCT : public CBase_DistFCT {
     //! Local mesh node ids associated to the global ones of owned elements
     //! \note This is a copy. Original in (bound) Discretization
     std::unordered_map< std::size_t, std::size_t > m_lid;
+    //! Communication plan for exchanging data on chare-boundary nodes
+    CommPlan m_plan;
     //! Mesh connectivity of our chunk of the mesh
     //! \note This is a copy. Original in (bound) Discretization
     std::vector< std::size_t > m_inpoel;
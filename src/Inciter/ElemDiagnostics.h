@@ -13,6 +13,8 @@
 #ifndef ElemDiagnostics_h
 #define ElemDiagnostics_h
 
+#include <array>
+
 #include "Discretization.h"
 #include "PUPUtil.h"
 #include "Diagnostics.h"
@@ -30,7 +32,9 @@ class ElemDiagnostics {
     bool compute( Discretization& d,
                   const std::size_t nchGhost,
                   const tk::Fields& geoElem,
-                  const tk::Fields& u ) const;
+                  const tk::Fields& u,
+                  const std::array< tk::real, 2 >& ghost,
+                  std::size_t nstage ) const;
 
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
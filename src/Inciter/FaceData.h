@@ -19,6 +19,7 @@
 #include "Types.h"
 #include "PUPUtil.h"
 #include "ContainerUtil.h"
+#include "ThreadPool.h"
 
 namespace inciter {
 
@@ -51,6 +52,10 @@ class FaceData {
               const std::map< int, std::vector< std::size_t > >& bface,
               const std::vector< std::size_t >& triinpoel );
 
+    //! \brief Color internal and chare-boundary faces for multithreaded
+    //!   face integrals
+    void colorFaces( std::size_t nthread );
+
     /** @name Accessors
       * */
     ///@{
@@ -66,6 +71,7 @@ class FaceData {
     const std::vector< std::size_t >& Belem() const { return m_belem; }
     const std::vector< int >& Esuf() const { return m_esuf; }
     std::vector< int >& Esuf() { return m_esuf; }
+    const tk::ColoredChunks& Colors() const { return m_colors; }
     //@}
 
     /** @name Charm++ pack/unpack (serialization) routines
@@ -81,6 +87,7 @@ class FaceData {
       p | m_inpofa;
       p | m_belem;
       p | m_esuf;
+      p | m_colors;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -103,6 +110,9 @@ class FaceData {
     std::vector< std::size_t > m_belem;
     //! Element surrounding faces
     std::vector< int > m_esuf;
+    //! \brief Internal and chare-boundary faces grouped by color and split into
+    //!   chunks, empty if not computed, see colorFaces()
+    tk::ColoredChunks m_colors;
 };
 
 } // inciter::
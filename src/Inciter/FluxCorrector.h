@@ -46,17 +46,6 @@ class FluxCorrector {
       m_aec.resize( is, g_inputdeck.get< tag::component >().nprop() );
     }
 
-    //! Compute antidiffusive element contributions (AEC)
-    void aec( const std::array< std::vector< tk::real >, 3 >& coord,
-              const std::vector< std::size_t >& inpoel,
-              const std::vector< tk::real >& vol,
-              const std::unordered_map< std::size_t,
-                      std::vector< std::pair< bool, tk::real > > >& bc,
-              const std::vector< std::size_t >& gid,
-              const tk::Fields& dUh,
-              const tk::Fields& Un,
-              tk::Fields& P );
-
     //! Verify the assembled antidiffusive element contributions
     bool verify( std::size_t nchare,
                  const std::vector< std::size_t >& inpoel,
@@ -64,13 +53,22 @@ class FluxCorrector {
                  const tk::Fields& dUl ) const;
 
     //! Compute lumped mass matrix lhs for low order system
-    tk::Fields lump( const std::array< std::vector< tk::real >, 3 >& coord,
-                     const std::vector< std::size_t >& inpoel ) const;
-
-    //! Compute mass diffusion contribution to the rhs of the low order system
-    tk::Fields diff( const std::array< std::vector< tk::real >, 3 >& coord,
+    tk::Fields lump( const tk::Fields& geoElem,
                      const std::vector< std::size_t >& inpoel,
-                     const tk::Fields& Un ) const;
+                     std::size_t npoin ) const;
+
+    //! \brief Compute mass diffusion contribution to the rhs of the low order
+    //!   system and antidiffusive element contributions (AEC)
+    void diff( const tk::Fields& geoElem,
+               const std::vector< std::size_t >& inpoel,
+               const std::vector< std::size_t >& elem,
+               const std::vector< tk::real >& vol,
+               const std::unordered_map< std::size_t,
+                       std::vector< std::pair< bool, tk::real > > >& bc,
+               const std::vector< std::size_t >& gid,
+               const tk::Fields& Un,
+               tk::Fields& D,
+               tk::Fields& P );
 
     //! \brief Compute the maximum and minimum unknowns of all elements
     //!   surrounding nodes
@@ -0,0 +1,216 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/LocalTimeStepping.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Multi-rate local time stepping for discontinuous Galerkin schemes
+  \details   Multi-rate local time stepping for discontinuous Galerkin schemes.
+    Elements are binned into power-of-two levels by their stable time step
+    size at the beginning of a cycle of 2^(L-1) time steps of size dt, L being
+    the number of levels. An element on level l takes local time steps of size
+    2^l dt, spanning 2^l time steps of the cycle. Its solution is kept at the
+    beginning of its local time step, so finer neighbors see a consistent
+    state, and it is advanced at the end of its local time step, in the last
+    of the time steps it spans, by the Runge-Kutta stages of that time step
+    with all its own integrals (volume, source, and faces) weighted by 2^l.
+    Faces shared with finer elements are integrated at the pace of the finer
+    element. Their contributions to the coarser element over the local time
+    step are accumulated, with the weights of the Runge-Kutta stages, and
+    replace the contributions of the same faces predicted by the coarse
+    element's own stages. The coarse element thus receives exactly what its
+    finer neighbors lose, so the scheme is conservative, and since the
+    predicted and the accumulated face contributions cancel for a uniform
+    state, it preserves free stream. Since the finer elements integrate the
+    faces they share with a coarser element using its state at the beginning
+    of its local time step, without interpolating it in time, interfaces
+    between levels are only first order accurate in time.
+
+    The functions here operate on plain arrays, and are used by DG, see
+    DG::ltsWeights(), DG::ltsUpdate(), and DG::ltsAdvance().
+*/
+// *****************************************************************************
+#ifndef LocalTimeStepping_h
+#define LocalTimeStepping_h
+
+#include <array>
+#include <vector>
+
+#include "Types.h"
+#include "Fields.h"
+
+namespace inciter {
+
+//! Local time stepping level of an element
+//! \param[in] dte Stable time step size of the element
+//! \param[in] dt Time step size, the smallest stable time step size
+//! \param[in] nlev Number of levels
+//! \return The largest level l, smaller than nlev, for which 2^l dt does not
+//!   exceed the stable time step size of the element
+inline std::size_t
+ltsLevel( tk::real dte, tk::real dt, std::size_t nlev )
+{
+  std::size_t l = 0;
+  while (l+1 < nlev && dte >= static_cast< tk::real >( 1UL << (l+1) ) * dt)
+    ++l;
+  return l;
+}
+
+//! Query if an element completes its local time step in a time step
+//! \param[in] l Level of the element
+//! \param[in] sub Time step within the local time stepping cycle
+//! \return True if the element is advanced in this time step
+inline bool
+ltsDue( std::size_t l, std::size_t sub )
+{
+  return (sub+1) % (1UL << l) == 0;
+}
+
+//! Compute element, face, and correction weights for a time step
+//! \tparam Level Functor returning the level of an element
+//! \param[in] esuf Elements surrounding faces, see tk::genEsuf()
+//! \param[in] nunk Number of elements (including ghosts)
+//! \param[in] sub Time step within the local time stepping cycle
+//! \param[in] level Functor returning the level of an element
+//! \param[out] ew Element weights: 2^l for elements advanced in this time
+//!   step, zero for all others
+//! \param[out] fw Face weights, two per face, applied to the contributions of
+//!   the face to its left and right element: the weight of the element if it
+//!   is advanced, otherwise the weight of the other element if that one is
+//!   advanced, i.e., the face contributes to the accumulated increments of a
+//!   coarser element, otherwise zero
+//! \param[out] cw Correction weights, two per face, nonzero only for a face
+//!   between two elements advanced in this time step on different levels:
+//!   for the coarser element, the difference of the finer and the coarser
+//!   element's weight, with which the prediction of the coarser element's own
+//!   stages is replaced by the face contribution at the pace of the finer one
+//! \return True if any of the correction weights is nonzero
+//! \details Weights are time step sizes in units of the smallest one. Zero
+//!   weights denote elements and faces skipped.
+template< class Level >
+bool
+ltsWeights( const std::vector< int >& esuf,
+            std::size_t nunk,
+            std::size_t sub,
+            const Level& level,
+            std::vector< tk::real >& ew,
+            std::vector< tk::real >& fw,
+            std::vector< tk::real >& cw )
+{
+  const auto nfac = esuf.size()/2;
+
+  auto weight = []( std::size_t l ){ return static_cast<tk::real>(1UL << l); };
+
+  ew.resize( nunk );
+  for (std::size_t e=0; e<nunk; ++e) {
+    const auto l = level(e);
+    ew[e] = ltsDue( l, sub ) ? weight(l) : 0.0;
+  }
+
+  fw.assign( 2*nfac, 0.0 );
+  cw.assign( 2*nfac, 0.0 );
+  bool correct = false;
+  for (std::size_t f=0; f<nfac; ++f) {
+    const auto el = static_cast< std::size_t >( esuf[2*f] );
+    if (esuf[2*f+1] < 0) {      // physical boundary face
+      fw[2*f] = ew[el];
+      continue;
+    }
+    const auto er = static_cast< std::size_t >( esuf[2*f+1] );
+    const std::array< std::size_t, 2 > e{{ el, er }};
+    for (std::size_t s=0; s<2; ++s) {
+      const auto x = e[s], y = e[1-s];
+      if (ew[x] > 0.0) {
+        fw[2*f+s] = ew[x];
+        if (ew[y] > 0.0 && ew[y] < ew[x]) {
+          cw[2*f+s] = ew[y] - ew[x];
+          correct = true;
+        }
+      } else {
+        fw[2*f+s] = ew[y];
+      }
+    }
+  }
+
+  return correct;
+}
+
+//! Advance a Runge-Kutta stage with local time stepping
+//! \param[in] nelem Number of elements to advance (excluding ghosts)
+//! \param[in] a Runge-Kutta coefficient multiplying the solution at the
+//!   beginning of the time step
+//! \param[in] b Runge-Kutta coefficient multiplying the stage update
+//! \param[in] w Weight of the stage contributing to the final increment of
+//!   the time step
+//! \param[in] dt Time step size
+//! \param[in] ew Element weights, see ltsWeights()
+//! \param[in] un Solution at the beginning of the time step
+//! \param[in] rhs Right-hand side computed with the face and element weights
+//! \param[in] corr Right-hand side computed with the correction weights, see
+//!   ltsWeights(), empty if all correction weights are zero
+//! \param[in] lhs Left-hand side (diagonal mass matrix)
+//! \param[in,out] u Solution advanced
+//! \param[in,out] acc Accumulated increments of elements
+//! \details Elements advanced in this time step are advanced by the
+//!   Runge-Kutta stage, u = a un + b (u + dt rhs/lhs), with their own
+//!   integrals weighted by their local time step size, and their correction
+//!   is accumulated. The solution of all other elements is kept and the
+//!   contributions of faces shared with advancing finer elements are
+//!   accumulated. Increments are accumulated with the weights the stages
+//!   contribute to the final increment of the time step.
+inline void
+ltsStage( std::size_t nelem,
+          tk::real a,
+          tk::real b,
+          tk::real w,
+          tk::real dt,
+          const std::vector< tk::real >& ew,
+          const tk::Fields& un,
+          const tk::Fields& rhs,
+          const tk::Fields& corr,
+          const tk::Fields& lhs,
+          tk::Fields& u,
+          tk::Fields& acc )
+{
+  const auto nprop = u.nprop();
+  const auto corrected = corr.nunk() > 0;
+
+  for (std::size_t e=0; e<nelem; ++e) {
+    if (ew[e] > 0.0) {
+      for (std::size_t c=0; c<nprop; ++c)
+        u(e,c,0) = a*un(e,c,0) + b*(u(e,c,0) + dt*rhs(e,c,0)/lhs(e,c,0));
+      if (corrected)
+        for (std::size_t c=0; c<nprop; ++c)
+          acc(e,c,0) += w*dt*corr(e,c,0)/lhs(e,c,0);
+    } else {
+      for (std::size_t c=0; c<nprop; ++c)
+        acc(e,c,0) += w*dt*rhs(e,c,0)/lhs(e,c,0);
+    }
+  }
+}
+
+//! Apply accumulated increments of elements advanced in this time step
+//! \param[in] nelem Number of elements (excluding ghosts)
+//! \param[in] ew Element weights, see ltsWeights()
+//! \param[in,out] u Solution
+//! \param[in,out] acc Accumulated increments, zeroed for elements advanced
+inline void
+ltsComplete( std::size_t nelem,
+             const std::vector< tk::real >& ew,
+             tk::Fields& u,
+             tk::Fields& acc )
+{
+  const auto nprop = u.nprop();
+
+  for (std::size_t e=0; e<nelem; ++e)
+    if (ew[e] > 0.0)
+      for (std::size_t c=0; c<nprop; ++c) {
+        u(e,c,0) += acc(e,c,0);
+        acc(e,c,0) = 0.0;
+      }
+}
+
+} // inciter::
+
+#endif // LocalTimeStepping_h
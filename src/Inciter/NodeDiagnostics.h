@@ -13,6 +13,7 @@
 #ifndef NodeDiagnostics_h
 #define NodeDiagnostics_h
 
+#include <array>
 #include <unordered_set>
 
 #include "Discretization.h"
@@ -29,7 +30,10 @@ class NodeDiagnostics {
     static void registerReducers();
 
     //! Compute diagnostics, e.g., residuals, norms of errors, etc.
-    bool compute( Discretization& d, const tk::Fields& u ) const;
+    bool compute( Discretization& d,
+                  const tk::Fields& u,
+                  const std::array< tk::real, 2 >& comm = {{ 0.0, 0.0 }},
+                  std::size_t nstep = 1 ) const;
 
     /** @name Charm++ pack/unpack serializer member functions */
     ///@{
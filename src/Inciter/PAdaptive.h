@@ -0,0 +1,130 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/PAdaptive.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Smoothness indicator selecting polynomial degrees for p-adaptive DG
+  \details   Smoothness indicator selecting polynomial degrees for p-adaptive
+    discontinuous Galerkin schemes. The indicator of an element is the largest
+    jump in the cell averages of the scalar components across its faces, each
+    normalized by a reference magnitude of the component. Normalizing by the
+    magnitudes of the two cell averages themselves would flag components that
+    smoothly change sign, e.g., momentum components, since their jump is then
+    comparable to their values. The reference magnitudes are those of the
+    whole mesh, so the degree selected for an element is independent of the
+    partitioning. The functions here operate on plain arrays, and are used by
+    DG, see DG::dt() and DG::selectNdof().
+*/
+// *****************************************************************************
+#ifndef PAdaptive_h
+#define PAdaptive_h
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include "Types.h"
+#include "Fields.h"
+#include "Exception.h"
+
+namespace inciter {
+
+//! Largest magnitudes of the cell averages of the scalar components
+//! \param[in] U Solution vector, ndof dofs per scalar component
+//! \param[in] ncomp Number of scalar components
+//! \param[in] ndof Number of degrees of freedom per scalar component
+//! \param[in] nelem Number of elements to consider, the first nelem of U
+//! \return Largest magnitude of the cell average of each scalar component on
+//!   the first nelem elements of U
+//! \details Called on the elements owned by a chare, excluding ghosts, so
+//!   that the maximum of the magnitudes across all chares, see DG::dt(), is
+//!   that of the whole mesh.
+inline std::vector< tk::real >
+prefMagnitude( const tk::Fields& U,
+               std::size_t ncomp,
+               std::size_t ndof,
+               std::size_t nelem )
+{
+  Assert( nelem <= U.nunk(), "Number of elements exceeds that of U" );
+  std::vector< tk::real > mag( ncomp, 0.0 );
+  for (std::size_t e=0; e<nelem; ++e)
+    for (std::size_t c=0; c<ncomp; ++c)
+      mag[c] = std::max( mag[c], std::abs( U(e,c*ndof,0) ) );
+  return mag;
+}
+
+//! Reference magnitudes of the scalar components for the smoothness indicator
+//! \param[in] mag Largest magnitudes of the cell averages of the scalar
+//!   components on the whole mesh, see prefMagnitude()
+//! \return Largest magnitude of each scalar component, but at least the
+//!   square root of the machine epsilon times the largest of all components,
+//!   so that components that are zero up to round-off, e.g., transverse
+//!   momentum in one-dimensional flow, are not flagged by their noise
+inline std::vector< tk::real >
+prefReference( std::vector< tk::real > mag )
+{
+  Assert( !mag.empty(), "No magnitudes to compute reference from" );
+  const auto floor = std::max(
+    std::sqrt( std::numeric_limits< tk::real >::epsilon() ) *
+      *std::max_element( begin(mag), end(mag) ),
+    std::numeric_limits< tk::real >::min() );
+  for (auto& r : mag) r = std::max( r, floor );
+  return mag;
+}
+
+//! Smoothness indicator of an element
+//! \param[in] e Element id
+//! \param[in] esuel Elements surrounding elements, see tk::genEsuelTet()
+//! \param[in] U Solution vector, ndof dofs per scalar component
+//! \param[in] ncomp Number of scalar components
+//! \param[in] ndof Number of degrees of freedom per scalar component
+//! \param[in] ref Reference magnitudes of scalar components, see
+//!   prefReference()
+//! \return Largest jump of the cell averages of all scalar components across
+//!   the faces of the element, normalized by the reference magnitude of the
+//!   component, a number between 0 and 2
+inline tk::real
+prefIndicator( std::size_t e,
+               const std::vector< int >& esuel,
+               const tk::Fields& U,
+               std::size_t ncomp,
+               std::size_t ndof,
+               const std::vector< tk::real >& ref )
+{
+  tk::real jump = 0.0;
+  for (std::size_t f=0; f<4; ++f) {
+    auto n = esuel[4*e+f];
+    if (n == -1) continue;
+    auto nb = static_cast< std::size_t >( n );
+    for (std::size_t c=0; c<ncomp; ++c)
+      jump = std::max( jump,
+               std::abs( U(e,c*ndof,0) - U(nb,c*ndof,0) ) / ref[c] );
+  }
+  return jump;
+}
+
+//! Number of degrees of freedom selected for an element
+//! \param[in] jump Smoothness indicator of the element, see prefIndicator()
+//! \param[in] tol Tolerance of the smoothness indicator
+//! \param[in] ndof Number of degrees of freedom configured (4: P1, 10: P2)
+//! \return Number of degrees of freedom of the highest polynomial degree
+//!   configured, decreased by one degree if the indicator exceeds the
+//!   tolerance, and by two if it exceeds ten times the tolerance
+inline std::size_t
+prefNdof( tk::real jump, tk::real tol, std::size_t ndof )
+{
+  // Number of dofs of polynomial degrees 0, 1, 2
+  const std::array< std::size_t, 3 > ndofp{{ 1, 4, 10 }};
+  const std::size_t pmax = ndof == 10 ? 2 : 1;
+
+  std::size_t drop = (jump > tol ? 1 : 0) + (jump > 10.0*tol ? 1 : 0);
+  return ndofp[ pmax - std::min( drop, pmax ) ];
+}
+
+} // inciter::
+
+#endif // PAdaptive_h
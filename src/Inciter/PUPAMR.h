@@ -25,10 +25,45 @@
 #include "AMR/refinement.h"
 #include "AMR/master_element_store.h"
 #include "AMR/id_generator.h"
+#include "AMR/flat_map.h"
 
 //! Extensions to Charm++'s Pack/Unpack routines
 namespace PUP {
 
+/** @name Charm++ pack/unpack serializer member functions for flat_map */
+///@{
+//! Pack/Unpack flat_map
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] m flat_map object reference
+template< class Key, class T, class Hash, class KeyEqual >
+void pup( PUP::er &p, AMR::flat_map< Key, T, Hash, KeyEqual >& m ) {
+  auto n = m.size();
+  p | n;
+  if (p.isUnpacking()) {
+    m.clear();
+    m.reserve( n );
+    for (std::size_t i=0; i<n; ++i) {
+      typename AMR::flat_map< Key, T, Hash, KeyEqual >::value_type v;
+      p | v.first;
+      p | v.second;
+      m.insert( v );
+    }
+  } else {
+    for (auto& v : m) {
+      p | v.first;
+      p | v.second;
+    }
+  }
+}
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] m flat_map object reference
+template< class Key, class T, class Hash, class KeyEqual >
+inline void operator|( PUP::er& p,
+                       AMR::flat_map< Key, T, Hash, KeyEqual >& m )
+{ pup(p,m); }
+//@}
+
 /** @name Charm++ pack/unpack serializer member functions for Refinement_State */
 ///@{
 //! Pack/Unpack Refinement_State
@@ -292,6 +292,18 @@ class Scheme : public SchemeBase {
         call_advance<Args...>( std::forward<Args>(args)... ), proxy );
     }
 
+    //////  proxy.evalLB(...)
+    //! Function to call the evalLB entry method of an array proxy (broadcast)
+    //! \param[in] args Arguments to member function entry method to be called
+    //! \details This function calls the evalLB member function of a chare array
+    //!    proxy and thus equivalent to proxy.evalLB(...), using the last
+    //!    argument as default.
+    template< typename... Args >
+    void evalLB( Args&&... args ) {
+      boost::apply_visitor(
+        call_evalLB<Args...>( std::forward<Args>(args)... ), proxy );
+    }
+
     //////  proxy.diag(...)
     //! function to call the diag entry method of an array proxy (broadcast)
     //! \param[in] args arguments to member function (entry method) to be called
@@ -548,6 +560,27 @@ class Scheme : public SchemeBase {
        p.diag( std::forward<Args>(args)... );
      }
    };
+
+   //! Functor to call the chare entry method 'evalLB'
+   //! \details This class is intended to be used in conjunction with variant
+   //!   and boost::visitor. The template argument types are the types of the
+   //!   arguments to entry method to be invoked behind the variant holding a
+   //!   Charm++ proxy.
+   //! \see The base class Call for the definition of operator().
+   template< typename... As >
+   struct call_evalLB : Call< call_evalLB<As...>, As... > {
+     using Base = Call< call_evalLB<As...>, As... >;
+     using Base::Base; // inherit base constructors
+     //! Invoke the entry method
+     //! \param[in,out] p Proxy behind which the entry method is called
+     //! \param[in] args Function arguments passed to entry method
+     //! \details P is the proxy type, Args are the types of the arguments of
+     //!   the entry method to be called.
+     template< typename P, typename... Args >
+     static void invoke( P& p, Args&&... args ) {
+       p.evalLB( std::forward<Args>(args)... );
+     }
+   };
 };
 
 } // inciter::
@@ -226,6 +226,9 @@ class Sorter : public CBase_Sorter {
     //! Reorder global mesh node IDs
     void reorder();
 
+    //! Order our node IDs in which to assign new IDs during reordering
+    std::vector< std::size_t > ordering() const;
+
     //! Associate new node IDs to old ones and return them to the requestor(s)
     void prepare();
 
@@ -63,6 +63,16 @@ class Transporter : public CBase_Transporter {
     //! Constructor
     explicit Transporter();
 
+    #if defined(__clang__)
+      #pragma clang diagnostic push
+      #pragma clang diagnostic ignored "-Wundefined-func-template"
+    #endif
+    //! Migrate constructor: returning from a checkpoint
+    explicit Transporter( CkMigrateMessage* m );
+    #if defined(__clang__)
+      #pragma clang diagnostic pop
+    #endif
+
     //! Reduction target: the mesh has been read from file on all PEs
     void load( std::size_t nelem, std::size_t nnode );
 
@@ -154,17 +164,18 @@ class Transporter : public CBase_Transporter {
 
     //! \brief Reduction target yielding the minimum mesh statistics across
     //!   all workers
-    void minstat( tk::real d0, tk::real d1, tk::real d2 );
+    void minstat( tk::real d0, tk::real d1, tk::real d2, tk::real d3 );
 
     //! \brief Reduction target yielding the maximum mesh statistics across
     //!   all workers
-    void maxstat( tk::real d0, tk::real d1, tk::real d2 );
+    void maxstat( tk::real d0, tk::real d1, tk::real d2, tk::real d3 );
 
     //! \brief Reduction target yielding the sum of mesh statistics across
     //!   all workers
     void sumstat( tk::real d0, tk::real d1,
                   tk::real d2, tk::real d3,
-                  tk::real d4, tk::real d5 );
+                  tk::real d4, tk::real d5,
+                  tk::real d6 );
 
     //! \brief Reduction target yielding PDF of mesh statistics across all
     //!    workers
@@ -183,6 +194,47 @@ class Transporter : public CBase_Transporter {
     //! Normal finish of time stepping
     void finish();
 
+    //! Reduction target reporting the timing of field output at finish
+    void written( tk::real writetime, tk::real waittime );
+
+    //! Aggregated field output has been merged into a single file
+    void merged();
+
+    //! Reduction target: all workers are ready to be checkpointed
+    void checkpoint();
+
+    //! Continue time stepping after a checkpoint or a restart
+    void resume();
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \details The pretty printer, the timers, and the progress reports are
+    //!   not migrated: they are recreated by the migrate constructor.
+    void pup( PUP::er &p ) override {
+      p | m_nchare;
+      p | m_ncit;
+      p | m_nt0refit;
+      p | m_ndtrefit;
+      p | m_scheme;
+      p | m_partitioner;
+      p | m_refiner;
+      p | m_meshwriter;
+      p | m_sorter;
+      p | m_nelem;
+      p | m_npoin_larger;
+      p | m_V;
+      p | m_minstat;
+      p | m_maxstat;
+      p | m_avgstat;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] t Transporter object reference
+    friend void operator|( PUP::er& p, Transporter& t ) { t.pup(p); }
+    //@}
+
   private:
     InciterPrint m_print;                //!< Pretty printer
     int m_nchare;                        //!< Number of worker chares
@@ -199,19 +251,23 @@ class Transporter : public CBase_Transporter {
      //! Total mesh volume
     tk::real m_V;
     //! Minimum mesh statistics
-    std::array< tk::real, 3 > m_minstat;
+    std::array< tk::real, 4 > m_minstat;
     //! Maximum mesh statistics
-    std::array< tk::real, 3 > m_maxstat;
+    std::array< tk::real, 4 > m_maxstat;
     //! Average mesh statistics
-    std::array< tk::real, 3 > m_avgstat;
+    std::array< tk::real, 4 > m_avgstat;
     //! Timer tags
-    enum class TimerTag { MESH_READ=0 };
+    enum class TimerTag { MESH_READ=0, CHECKPOINT, STEP };
     //! Timers
     std::map< TimerTag, tk::Timer > m_timer;
     //! Progress object for preparing mesh
     tk::Progress< 7 > m_progMesh;
     //! Progress object for preparing workers
     tk::Progress< 5 > m_progWork;
+    //! True if restarted from a checkpoint and time stepping not yet resumed
+    bool m_restarted;
+    //! Average wall-clock time of a time step between the last two checkpoints
+    tk::real m_steptime;
 
     //! Create mesh partitioner and boundary condition object group
     void createPartitioner();
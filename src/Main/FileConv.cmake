@@ -13,6 +13,7 @@ config_executable(${FILECONV_EXECUTABLE})
 target_link_libraries(${FILECONV_EXECUTABLE}
                       ExodusIIMeshIO
                       ${ROOTMESHIO}
+                      NativeMeshIO
                       Mesh
                       FileConvControl
                       Base
@@ -33,6 +33,8 @@ class FileConvDriver {
     void execute() const;
 
   private:
+    //! Convert aggregated field output to one ExodusII file per chare
+    void convertAggregate() const;
 
     std::string m_input;                //!< Input file name
     std::string m_output;               //!< Output file name
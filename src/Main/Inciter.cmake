@@ -15,6 +15,7 @@ target_link_libraries(${INCITER_EXECUTABLE}
                       MeshRefinement
                       LoadBalance
                       ZoltanInterOp
+                      NativeMeshIO
                       Base
                       Config
                       Init
@@ -27,6 +27,19 @@ class LBSwitch : public CBase_LBSwitch {
     //! Constructor: turn on automatic load balancing
     explicit LBSwitch( bool verbose );
 
+    #if defined(__clang__)
+      #pragma clang diagnostic push
+      #pragma clang diagnostic ignored "-Wundefined-func-template"
+    #endif
+    //! Migrate constructor: turn on automatic load balancing after restart
+    //! \details Called only when restarting from a checkpoint, since groups do
+    //!   not migrate otherwise.
+    explicit LBSwitch( CkMigrateMessage* m ) : CBase_LBSwitch( m )
+    { TurnManualLBOff(); }
+    #if defined(__clang__)
+      #pragma clang diagnostic pop
+    #endif
+
     //! Turn off automatic load balancing
     static void off();
 };
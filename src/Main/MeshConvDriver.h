@@ -35,6 +35,10 @@ class MeshConvDriver {
   private:
     const tk::Print& m_print;           //!< Pretty printer
     const bool m_reorder;               //!< Whether to also reorder mesh nodes
+    //! Mesh ordering algorithm to use if reordering
+    const tk::ctr::MeshOrderingType m_ordering;
+    //! Number of threads parsing Gmsh and Netgen meshes
+    const std::size_t m_nthread;
     std::string m_input;                //!< Input file name
     std::string m_output;               //!< Output file name
 };
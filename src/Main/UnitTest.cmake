@@ -22,12 +22,15 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Base/TestFactory.C
                ../../tests/unit/Base/TestFlip_map.C
                ../../tests/unit/Base/TestHas.C
+               ../../tests/unit/Base/TestMappedFile.C
                ../../tests/unit/Base/TestPrint.C
                ../../tests/unit/Base/TestProcessControl.C
                ../../tests/unit/Base/TestPUPUtil.C
                ../../tests/unit/Base/TestReader.C
                ../../tests/unit/Base/TestStrConvUtil.C
                ../../tests/unit/Base/TestTaggedTuple.C
+               ../../tests/unit/Base/TestTable.C
+               ../../tests/unit/Base/TestThreadPool.C
                ../../tests/unit/Base/TestTimer.C
                ../../tests/unit/Base/TestVector.C
                ../../tests/unit/Base/TestWriter.C
@@ -42,7 +45,11 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Control/TestSystemComponents.C
                ../../tests/unit/Control/TestToggle.C
                ../../tests/unit/${TestScheme}
+               ../../tests/unit/${TestLocalTimeStepping}
+               ../../tests/unit/${TestPAdaptive}
                ../../tests/unit/${TestError}
+               ../../tests/unit/${TestFlatMap}
+               ../../tests/unit/IO/TestAggregateField.C
                ../../tests/unit/IO/TestExodusIIMeshReader.C
                ../../tests/unit/IO/TestMesh.C
                ../../tests/unit/IO/TestMeshReader.C
@@ -54,10 +61,12 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Mesh/TestDerivedData_MPISingle.C
                ../../tests/unit/Mesh/TestGradients.C
                ../../tests/unit/Mesh/TestReorder.C
+               ../../tests/unit/${TestRiemann}
                ../../tests/unit/${TestMKLRNG}
                ../../tests/unit/${TestRNGSSE}
                ../../tests/unit/RNG/TestRNG.C
-               ../../tests/unit/RNG/TestRandom123.C)
+               ../../tests/unit/RNG/TestRandom123.C
+               ../../tests/unit/Statistics/TestPDF.C)
 
 target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
                            ${QUINOA_SOURCE_DIR}
@@ -65,6 +74,8 @@ target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
                            ${QUINOA_SOURCE_DIR}/LoadBalance
                            ${QUINOA_SOURCE_DIR}/IO
                            ${QUINOA_SOURCE_DIR}/RNG
+                           ${QUINOA_SOURCE_DIR}/PDE
+                           ${QUINOA_SOURCE_DIR}/Statistics
                            ${TUT_INCLUDE_DIRS}
                            ${LAPACKE_INCLUDE_DIRS}
                            ${PROJECT_BINARY_DIR}/../UnitTest
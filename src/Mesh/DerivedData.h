@@ -144,6 +144,10 @@ genBelemTet( std::size_t nbfac,
               const std::pair< std::vector< std::size_t >,
                                std::vector< std::size_t > >& esup );
 
+//! Generate the set of unique faces of tetrahedra
+UnsMesh::FaceSet
+genTetFaces( const std::vector< std::size_t >& inpoel );
+
 //! Generate derived data structure, face geometry
 tk::Fields
 genGeoFaceTri( std::size_t nipfac,
@@ -161,6 +165,33 @@ tk::Fields
 genGeoElemTet( const std::vector< std::size_t >& inpoel,
                const tk::UnsMesh::Coords& coord );
 
+//! \brief Generate derived data structure, element Jacobians and shape function
+//!   gradients of linear tetrahedra
+tk::Fields
+genGeoElemGrad( const std::vector< std::size_t >& inpoel,
+                const tk::UnsMesh::Coords& coord );
+
+//! \brief Generate derived data structure, edge coefficients of the
+//!   edge-based (median-dual) assembly of linear tetrahedra
+tk::Fields
+genEdgeCoef( const std::vector< std::size_t >& inpoel,
+             const std::vector< std::size_t >& inpoed,
+             const tk::Fields& geoElemGrad );
+
+//! \brief Generate derived data structure, node coefficients of the edge-based
+//!   (median-dual) assembly of linear tetrahedra
+tk::Fields
+genNodeCoef( const std::vector< std::size_t >& inpoel,
+             const tk::Fields& geoElemGrad,
+             std::size_t npoin );
+
+//! \brief Generate derived data structure, coloring of mesh entities so that
+//!   entities of the same color share no point
+std::vector< std::vector< std::size_t > >
+genColors( const std::vector< std::size_t >& inpoel,
+           std::size_t nnpe,
+           const std::vector< std::size_t >& items );
+
 //! Perform leak-test on mesh (partition)
 bool
 leakyPartition( const std::vector< int >& esueltet,
@@ -61,6 +61,28 @@ std::vector< std::size_t >
 renumber( const std::pair< std::vector< std::size_t >,
                            std::vector< std::size_t > >& psup );
 
+//! Reorder mesh points with the reverse Cuthill-McKee algorithm
+std::vector< std::size_t >
+renumberRCM( const std::pair< std::vector< std::size_t >,
+                              std::vector< std::size_t > >& psup );
+
+//! Reorder mesh points along a Hilbert space-filling curve
+std::vector< std::size_t >
+renumberHilbert( const std::array< std::vector< real >, 3 >& coord );
+
+//! Reorder mesh points along a Morton (Z-order) space-filling curve
+std::vector< std::size_t >
+renumberMorton( const std::array< std::vector< real >, 3 >& coord );
+
+//! Reorder mesh elements consistently with the order of their nodes
+std::vector< std::size_t >
+renumberElems( std::vector< std::size_t >& inpoel, std::size_t nnpe );
+
+//! Compute bandwidth and average node ID distance of the edges of a mesh graph
+std::pair< std::size_t, tk::real >
+bandwidth( const std::pair< std::vector< std::size_t >,
+                            std::vector< std::size_t > >& psup );
+
 //! Assign local ids to global ids
 std::unordered_map< std::size_t, std::size_t >
 assignLid( const std::vector< std::size_t >& gid );
@@ -96,10 +96,24 @@ class CGPDE {
               tk::real deltat,
               const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
+              const std::vector< std::size_t >& elem,
               const tk::Fields& U,
               tk::Fields& Ue,
               tk::Fields& R ) const
-    { self->rhs( t, deltat, coord, inpoel, U, Ue, R ); }
+    { self->rhs( t, deltat, coord, inpoel, geoElem, elem, U, Ue, R ); }
+
+    //! \brief Public interface to computing the right-hand side vector for the
+    //!   diff eq using edge-based assembly
+    void rhs( tk::real t,
+              const std::array< std::vector< tk::real >, 3 >& coord,
+              const std::vector< std::size_t >& inpoed,
+              const tk::Fields& edgeCoef,
+              const tk::Fields& nodeCoef,
+              const std::vector< tk::real >& vol,
+              const tk::Fields& U,
+              tk::Fields& R ) const
+    { self->rhs( t, coord, inpoed, edgeCoef, nodeCoef, vol, U, R ); }
 
     //! Public interface for computing the minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
@@ -171,8 +185,18 @@ class CGPDE {
                         const std::array< std::vector< tk::real >, 3 >&,
                         const std::vector< std::size_t >&,
                         const tk::Fields&,
+                        const std::vector< std::size_t >&,
+                        const tk::Fields&,
                         tk::Fields&,
                         tk::Fields& ) const = 0;
+      virtual void rhs( tk::real,
+                        const std::array< std::vector< tk::real >, 3 >&,
+                        const std::vector< std::size_t >&,
+                        const tk::Fields&,
+                        const tk::Fields&,
+                        const std::vector< tk::real >&,
+                        const tk::Fields&,
+                        tk::Fields& ) const = 0;
       virtual tk::real dt( const std::array< std::vector< tk::real >, 3 >&,
                            const std::vector< std::size_t >&,
                            const tk::Fields& ) const = 0;
@@ -215,10 +239,21 @@ class CGPDE {
                 tk::real deltat,
                 const std::array< std::vector< tk::real >, 3 >& coord,
                 const std::vector< std::size_t >& inpoel,
+                const tk::Fields& geoElem,
+                const std::vector< std::size_t >& elem,
                 const tk::Fields& U,
                 tk::Fields& Ue,
                 tk::Fields& R ) const override
-      { data.rhs( t, deltat, coord, inpoel, U, Ue, R ); }
+      { data.rhs( t, deltat, coord, inpoel, geoElem, elem, U, Ue, R ); }
+      void rhs( tk::real t,
+                const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< std::size_t >& inpoed,
+                const tk::Fields& edgeCoef,
+                const tk::Fields& nodeCoef,
+                const std::vector< tk::real >& vol,
+                const tk::Fields& U,
+                tk::Fields& R ) const override
+      { data.rhs( t, coord, inpoed, edgeCoef, nodeCoef, vol, U, R ); }
       tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                    const std::vector< std::size_t >& inpoel,
                    const tk::Fields& U ) const override
@@ -181,14 +181,25 @@ class CompFlow {
     //! \param[in] deltat Size of time step
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] geoElem Element Jacobians and shape function gradients, see
+    //!   tk::genGeoElemGrad()
+    //! \param[in] elem Ids of the elements whose contributions to compute
     //! \param[in] U Solution vector at recent time step
     //! \param[in,out] Ue Element-centered solution vector at intermediate step
     //!    (used here internally as a scratch array)
-    //! \param[in,out] R Right-hand side vector computed
+    //! \param[in,out] R Right-hand side vector to add contributions to
+    //! \details Contributions of the elements in elem are added to R, thus
+    //!   the rhs can be computed for a subset of the elements at a time. The
+    //!   element values at the intermediate step only depend on the nodes of
+    //!   the element, so both stages, the gather from the nodes and the scatter
+    //!   of the fluxes to the nodes, are done in a single pass over the
+    //!   elements.
     void rhs( tk::real t,
               tk::real deltat,
               const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
+              const std::vector< std::size_t >& elem,
               const tk::Fields& U,
               tk::Fields& Ue,
               tk::Fields& R ) const
@@ -198,6 +209,8 @@ class CompFlow {
       Assert( R.nunk() == coord[0].size(),
               "Number of unknowns and/or number of components in right-hand "
               "side vector incorrect" );
+      Assert( geoElem.nunk() == inpoel.size()/4 && geoElem.nprop() == 13,
+              "Element geometry size mismatch" );
 
       const auto& x = coord[0];
       const auto& y = coord[1];
@@ -206,34 +219,31 @@ class CompFlow {
       // ratio of specific heats
       auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
 
-      // 1st stage: update element values from node values (gather-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      // access pointer to element solution and right hand side at component
+      // and offset
+      std::array< const tk::real*, 5 > ue, r;
+      for (ncomp_t c=0; c<5; ++c) {
+        ue[c] = Ue.cptr( c, m_offset );
+        r[c] = R.cptr( c, m_offset );
+      }
+
+      for (auto e : elem) {
 
         // access node IDs
         const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
                                                inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
+        // element Jacobi determinant, J = 6V
+        const auto J = geoElem(e,0,0);
 
         // shape function derivatives, nnode*ndim [4][3]
         std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+        for (std::size_t a=0; a<4; ++a)
+          for (std::size_t j=0; j<3; ++j)
+            grad[a][j] = geoElem(e,1+a*3+j,0);
 
         // access solution at element nodes
         std::array< std::array< tk::real, 4 >, 5 > u;
         for (ncomp_t c=0; c<5; ++c) u[c] = U.extract( c, m_offset, N );
-        // access solution at elements
-        std::array< const tk::real*, 5 > ue;
-        for (ncomp_t c=0; c<5; ++c) ue[c] = Ue.cptr( c, m_offset );
 
         // pressure
         std::array< tk::real, 4 > p;
@@ -275,68 +285,37 @@ class CompFlow {
           for (std::size_t a=0; a<4; ++a)
             Ue.var(ue[c],e) += d/4.0 * s[a][c];
 
-      }
-
+        // element solution at the intermediate step
+        std::array< tk::real, 5 > uh;
+        for (ncomp_t c=0; c<5; ++c) uh[c] = Ue.var(ue[c],e);
 
-      // zero right hand side for all components
-      for (ncomp_t c=0; c<5; ++c) R.fill( c, m_offset, 0.0 );
-
-      // 2nd stage: form rhs from element values (scatter-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-
-        // access node IDs
-        const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                               inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
-
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-        // access solution at elements
-        std::array< tk::real, 5 > ue;
-        for (ncomp_t c=0; c<5; ++c) ue[c] = Ue( e, c, m_offset );
-        // access pointer to right hand side at component and offset
-        std::array< const tk::real*, 5 > r;
-        for (ncomp_t c=0; c<5; ++c) r[c] = R.cptr( c, m_offset );
-
-        // pressure
-        auto p = (g-1.0)*(ue[4] -
-                   (ue[1]*ue[1] + ue[2]*ue[2] + ue[3]*ue[3])/2.0/ue[0]);
+        // pressure at the intermediate step
+        auto ph = (g-1.0)*(uh[4] -
+                    (uh[1]*uh[1] + uh[2]*uh[2] + uh[3]*uh[3])/2.0/uh[0]);
 
         // scatter-add flux contributions to rhs at nodes
-        tk::real d = deltat * J/6.0;
+        d = deltat * J/6.0;
         for (std::size_t j=0; j<3; ++j)
           for (std::size_t a=0; a<4; ++a) {
             // mass: advection
-            R.var(r[0],N[a]) += d * grad[a][j] * ue[j+1];
+            R.var(r[0],N[a]) += d * grad[a][j] * uh[j+1];
             // momentum: advection
             for (std::size_t i=0; i<3; ++i)
-              R.var(r[i+1],N[a]) += d * grad[a][j] * ue[j+1]*ue[i+1]/ue[0];
+              R.var(r[i+1],N[a]) += d * grad[a][j] * uh[j+1]*uh[i+1]/uh[0];
             // momentum: pressure
-            R.var(r[j+1],N[a]) += d * grad[a][j] * p;
+            R.var(r[j+1],N[a]) += d * grad[a][j] * ph;
             // energy: advection and pressure
-            R.var(r[4],N[a]) += d * grad[a][j] * (ue[4] + p) * ue[j+1]/ue[0];
+            R.var(r[4],N[a]) += d * grad[a][j] * (uh[4] + ph) * uh[j+1]/uh[0];
           }
 
         // add (optional) source to all equations
         auto xc = (x[N[0]] + x[N[1]] + x[N[2]] + x[N[3]]) / 4.0;
         auto yc = (y[N[0]] + y[N[1]] + y[N[2]] + y[N[3]]) / 4.0;
         auto zc = (z[N[0]] + z[N[1]] + z[N[2]] + z[N[3]]) / 4.0;
-        auto s = Problem::src( m_system, m_ncomp, xc, yc, zc, t+deltat/2 );
+        auto sc = Problem::src( m_system, m_ncomp, xc, yc, zc, t+deltat/2 );
         for (std::size_t c=0; c<5; ++c)
           for (std::size_t a=0; a<4; ++a)
-            R.var(r[c],N[a]) += d/4.0 * s[c];
+            R.var(r[c],N[a]) += d/4.0 * sc[c];
 
       }
 //         // add viscous stress contribution to momentum and energy rhs
@@ -345,6 +324,112 @@ class CompFlow {
 //         Physics::conductRhs( deltat, J, N, grad, u, r, R );
     }
 
+    //! Compute right hand side using edge-based assembly
+    //! \param[in] t Physical time
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoed Edge connectivity, see tk::genInpoed()
+    //! \param[in] edgeCoef Edge coefficients, see tk::genEdgeCoef()
+    //! \param[in] nodeCoef Node coefficients, see tk::genNodeCoef()
+    //! \param[in] vol Nodal volumes (without contributions from other chares)
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] R Right-hand side vector to add contributions to
+    //! \details The fluxes are interpolated from the nodes, thus they are
+    //!   computed once per node, then assembled in a single pass over the
+    //!   edges, see tk::genEdgeCoef(). The boundary integral of the fluxes is
+    //!   lumped to the nodes using the node coefficients, see
+    //!   tk::genNodeCoef(), thus a uniform state is preserved and the scheme
+    //!   is conservative. The central Galerkin fluxes are stabilized by an
+    //!   edge-based artificial viscosity proportional to the largest
+    //!   characteristic speed (fluid velocity + sound speed) at the two
+    //!   end-points of the edge, which yields a local Lax-Friedrichs
+    //!   (Rusanov) flux across the median-dual faces. Sources are lumped to
+    //!   the nodes.
+    void rhs( tk::real t,
+              const std::array< std::vector< tk::real >, 3 >& coord,
+              const std::vector< std::size_t >& inpoed,
+              const tk::Fields& edgeCoef,
+              const tk::Fields& nodeCoef,
+              const std::vector< tk::real >& vol,
+              const tk::Fields& U,
+              tk::Fields& R ) const
+    {
+      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
+              "vector at recent time step incorrect" );
+      Assert( R.nunk() == coord[0].size(),
+              "Number of unknowns and/or number of components in right-hand "
+              "side vector incorrect" );
+      Assert( edgeCoef.nunk() == inpoed.size()/2 && edgeCoef.nprop() == 10,
+              "Edge coefficients size mismatch" );
+      Assert( nodeCoef.nunk() == coord[0].size() && nodeCoef.nprop() == 3,
+              "Node coefficients size mismatch" );
+
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      const auto npoin = U.nunk();
+
+      // ratio of specific heats
+      auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
+
+      // access pointer to solution and right hand side at component and offset
+      std::array< const tk::real*, 5 > u, r;
+      for (ncomp_t c=0; c<5; ++c) {
+        u[c] = U.cptr( c, m_offset );
+        r[c] = R.cptr( c, m_offset );
+      }
+
+      // compute fluxes at nodes, f[p*15+c*3+j]: flux of component c in
+      // direction j at node p, and characteristic speeds at nodes, then add
+      // own-flux, boundary, and source contributions
+      std::vector< tk::real > f( npoin*15 ), s( npoin );
+      for (std::size_t p=0; p<npoin; ++p) {
+        std::array< tk::real, 5 > q;
+        for (ncomp_t c=0; c<5; ++c) q[c] = U.var(u[c],p);
+        auto pr = (g-1.0)*(q[4] - (q[1]*q[1] + q[2]*q[2] + q[3]*q[3])/2.0/q[0]);
+        auto fp = f.data() + p*15;
+        for (std::size_t j=0; j<3; ++j) {
+          auto vj = q[j+1]/q[0];
+          fp[j] = q[j+1];                               // mass: advection
+          for (std::size_t i=0; i<3; ++i)
+            fp[(i+1)*3+j] = q[i+1]*vj;                  // momentum: advection
+          fp[(j+1)*3+j] += pr;                          // momentum: pressure
+          fp[12+j] = (q[4] + pr)*vj;                    // energy
+        }
+        // fluid velocity + sound speed
+        s[p] = std::sqrt( (q[1]*q[1] + q[2]*q[2] + q[3]*q[3])/q[0]/q[0] ) +
+               std::sqrt( g*std::max(pr,0.0)/q[0] );
+        // own-flux contribution (b_p.F_p) minus the boundary integral lumped
+        // to the node (4 b_p.F_p), nonzero on (chare-)boundary nodes only,
+        // whose sum across chares is nonzero on the physical boundary only
+        for (ncomp_t c=0; c<5; ++c)
+          for (std::size_t j=0; j<3; ++j)
+            R.var(r[c],p) -= 3.0 * nodeCoef(p,j,0) * fp[c*3+j];
+        // add (optional) source to all equations
+        auto src = Problem::src( m_system, m_ncomp, x[p], y[p], z[p], t );
+        for (ncomp_t c=0; c<5; ++c) R.var(r[c],p) += vol[p] * src[c];
+      }
+
+      // scatter-add flux and artificial viscosity contributions to rhs at
+      // edge-end points
+      for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+        const auto p = inpoed[e*2+0];
+        const auto q = inpoed[e*2+1];
+        const auto fp = f.data() + p*15;
+        const auto fq = f.data() + q*15;
+        const auto d = edgeCoef(e,9,0) * std::max( s[p], s[q] );
+        for (ncomp_t c=0; c<5; ++c) {
+          tk::real rp = 0.0, rq = 0.0;
+          for (std::size_t j=0; j<3; ++j) {
+            rp += edgeCoef(e,j,0) * fq[c*3+j];
+            rq += edgeCoef(e,3+j,0) * fp[c*3+j];
+          }
+          const auto v = d * (U.var(u[c],q) - U.var(u[c],p));
+          R.var(r[c],p) += rp + v;
+          R.var(r[c],q) += rq - v;
+        }
+      }
+    }
+
     //! Compute the minimum time step size
     //! \param[in] U Solution vector at recent time step
     //! \param[in] coord Mesh node coordinates
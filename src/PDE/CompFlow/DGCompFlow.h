@@ -118,20 +118,31 @@ class CompFlow {
     //! \param[in] t Physical time
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
+    //! \param[in] geoFaceGp Face quadrature-point data (empty if not cached)
+    //! \param[in] geoElemGp Element quadrature-point data (empty if not cached)
     //! \param[in] fd Face connectivity and boundary conditions object
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] U Solution vector at recent time step
     //! \param[in] limFunc Limiter function for higher-order solution dofs
+    //! \param[in] ndofel Number of degrees of freedom active on each element
+    //!   (empty: all ndof)
+    //! \param[in] fw Face weights for local time stepping (empty: all ones)
+    //! \param[in] ew Element weights for local time stepping (empty: all ones)
     //! \param[in,out] R Right-hand side vector computed
     void rhs( tk::real t,
               const tk::Fields& geoFace,
               const tk::Fields& geoElem,
+              const tk::Fields& geoFaceGp,
+              const tk::Fields& geoElemGp,
               const inciter::FaceData& fd,
               const std::vector< std::size_t >& inpoel,
               const tk::UnsMesh::Coords& coord,
               const tk::Fields& U,
               const tk::Fields& limFunc,
+              const std::vector< std::size_t >& ndofel,
+              const std::vector< tk::real >& fw,
+              const std::vector< tk::real >& ew,
               tk::Fields& R ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
@@ -149,15 +160,9 @@ class CompFlow {
       // set rhs to zero
       R.fill(0.0);
 
-      // configure Riemann flux function
-      auto rieflxfn =
-       [this]( const std::array< tk::real, 3 >& fn,
-               const std::array< std::vector< tk::real >, 2 >& u,
-               const std::vector< std::array< tk::real, 3 > >& v )
-             { return m_riemann.flux( fn, u, v ); };
       // configure a no-op lambda for prescribed velocity
-      auto velfn = [this]( ncomp_t, ncomp_t, tk::real, tk::real, tk::real ){
-        return std::vector< std::array< tk::real, 3 > >( this->m_ncomp ); };
+      auto velfn = []( ncomp_t, ncomp_t, tk::real, tk::real, tk::real,
+                       std::array< tk::real, 3 >* ){};
 
       // supported boundary condition types and associated state functions
       std::vector< std::pair< std::vector< bcconf_t >, tk::StateFn > > bctypes{{
@@ -167,21 +172,23 @@ class CompFlow {
 
       // compute internal surface flux integrals
       tk::surfInt( m_system, m_ncomp, m_offset, inpoel, coord, fd, geoFace,
-                   rieflxfn, velfn, U, limFunc, R );
+                   geoFaceGp, m_riemann, velfn, U, limFunc, ndofel, fw, R );
 
       // compute source term intehrals
       tk::srcInt( m_system, m_ncomp, m_offset,
-                  t, inpoel, coord, geoElem, Problem::src, R );
+                  t, inpoel, coord, geoElem, Problem::src, ndofel, ew,
+                  R );
 
       if(ndof > 1)
         // compute volume integrals
-        tk::volInt( m_system, m_ncomp, m_offset, inpoel, coord, geoElem, flux,
-                    velfn, U, limFunc, R );
+        tk::volInt( m_system, m_ncomp, m_offset, inpoel, coord, geoElem,
+                    geoElemGp, flux, velfn, U, limFunc, ndofel, ew, R );
 
       // compute boundary surface flux integrals
       for (const auto& b : bctypes)
-        tk::bndSurfInt( m_system, m_ncomp, m_offset, b.first, fd, geoFace, inpoel,
-                        coord, t, rieflxfn, velfn, b.second, U, limFunc, R );
+        tk::bndSurfInt( m_system, m_ncomp, m_offset, b.first, fd, geoFace,
+                        geoFaceGp, inpoel, coord, t, m_riemann, velfn,
+                        b.second, U, limFunc, ndofel, fw, R );
     }
 
     //! Compute the minimum time step size
@@ -192,6 +199,7 @@ class CompFlow {
     //! \param[in] geoElem Element geometry array
     //! \param[in] limFunc Limiter function for higher-order solution dofs
     //! \param[in] U Solution vector at recent time step
+    //! \param[out] dte Stable time step size of each element
     //! \return Minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
@@ -199,7 +207,8 @@ class CompFlow {
                  const tk::Fields& geoFace,
                  const tk::Fields& geoElem,
                  const tk::Fields& limFunc,
-                 const tk::Fields& U ) const
+                 const tk::Fields& U,
+                 std::vector< tk::real >& dte ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
       const tk::real g = g_inputdeck.get< tag::param, eq, tag::gamma >()[0];
@@ -352,11 +361,13 @@ class CompFlow {
       }
 
       tk::real mindt = std::numeric_limits< tk::real >::max();
+      dte.resize( U.nunk() );
 
       // compute allowable dt
       for (std::size_t e=0; e<U.nunk(); ++e)
       {
-        mindt = std::min( mindt, geoElem(e,0,0)/delt[e] );
+        dte[e] = geoElem(e,0,0)/delt[e];
+        mindt = std::min( mindt, dte[e] );
       }
 
       return mindt;
@@ -547,47 +558,52 @@ class CompFlow {
     //! Evaluate physical flux function for this PDE system
     //! \param[in] system Equation system index
     //! \param[in] ncomp Number of scalar components in this PDE system
-    //! \param[in] ugp Numerical solution at the Gauss point at which to
-    //!   evaluate the flux
-    //! \return Flux vectors for all components in this PDE system
-    //! \note The function signature must follow tk::FluxFn
-    static tk::FluxFn::result_type
+    //! \param[in] ng Number of points at which to evaluate the flux
+    //! \param[in] ugp Numerical solution at the points at which to evaluate
+    //!   the flux, ng x ncomp
+    //! \param[in,out] fl Flux vectors for all components in this PDE system at
+    //!   all points, ng x ncomp
+    //! \note The function signature must follow tk::FluxBatchFn
+    static void
     flux( ncomp_t system,
           ncomp_t ncomp,
-          const std::vector< tk::real >& ugp,
-          const std::vector< std::array< tk::real, 3 > >& )
+          std::size_t ng,
+          const tk::real* ugp,
+          const std::array< tk::real, 3 >*,
+          std::array< tk::real, 3 >* fl )
     {
-      Assert( ugp.size() == ncomp, "Size mismatch" );
-      IGNORE(ncomp);
+      Assert( ncomp == 5, "Number of components must be 5" );
 
       const auto g = g_inputdeck.get< tag::param, eq, tag::gamma >()[ system ];
 
-      auto u = ugp[1] / ugp[0];
-      auto v = ugp[2] / ugp[0];
-      auto w = ugp[3] / ugp[0];
-      auto p = (g - 1) * (ugp[4] - 0.5 * ugp[0] * (u*u + v*v + w*w) );
-
-      std::vector< std::array< tk::real, 3 > > fl( ugp.size() );
-
-      fl[0][0] = ugp[1];
-      fl[1][0] = ugp[1] * u + p;
-      fl[2][0] = ugp[1] * v;
-      fl[3][0] = ugp[1] * w;
-      fl[4][0] = u * (ugp[4] + p);
-
-      fl[0][1] = ugp[2];
-      fl[1][1] = ugp[2] * u;
-      fl[2][1] = ugp[2] * v + p;
-      fl[3][1] = ugp[2] * w;
-      fl[4][1] = v * (ugp[4] + p);
-
-      fl[0][2] = ugp[3];
-      fl[1][2] = ugp[3] * u;
-      fl[2][2] = ugp[3] * v;
-      fl[3][2] = ugp[3] * w + p;
-      fl[4][2] = w * (ugp[4] + p);
-
-      return fl;
+      for (std::size_t i=0; i<ng; ++i)
+      {
+        const auto U = ugp + i*ncomp;
+        const auto F = fl + i*ncomp;
+
+        auto u = U[1] / U[0];
+        auto v = U[2] / U[0];
+        auto w = U[3] / U[0];
+        auto p = (g - 1) * (U[4] - 0.5 * U[0] * (u*u + v*v + w*w) );
+
+        F[0][0] = U[1];
+        F[1][0] = U[1] * u + p;
+        F[2][0] = U[1] * v;
+        F[3][0] = U[1] * w;
+        F[4][0] = u * (U[4] + p);
+
+        F[0][1] = U[2];
+        F[1][1] = U[2] * u;
+        F[2][1] = U[2] * v + p;
+        F[3][1] = U[2] * w;
+        F[4][1] = v * (U[4] + p);
+
+        F[0][2] = U[3];
+        F[1][2] = U[3] * u;
+        F[2][2] = U[3] * v;
+        F[3][2] = U[3] * w + p;
+        F[4][2] = w * (U[4] + p);
+      }
     }
 
     //! \brief Boundary state function providing the left and right state of a
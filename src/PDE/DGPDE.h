@@ -93,13 +93,19 @@ class DGPDE {
     void rhs( tk::real t,
               const tk::Fields& geoFace,
               const tk::Fields& geoElem,
+              const tk::Fields& geoFaceGp,
+              const tk::Fields& geoElemGp,
               const inciter::FaceData& fd,
               const std::vector< std::size_t >& inpoel,
               const tk::UnsMesh::Coords& coord,
               const tk::Fields& U,
               const tk::Fields& limFunc,
+              const std::vector< std::size_t >& ndofel,
+              const std::vector< tk::real >& fw,
+              const std::vector< tk::real >& ew,
               tk::Fields& R ) const
-    { self->rhs( t, geoFace, geoElem, fd, inpoel, coord, U, limFunc, R ); }
+    { self->rhs( t, geoFace, geoElem, geoFaceGp, geoElemGp, fd, inpoel, coord,
+                 U, limFunc, ndofel, fw, ew, R ); }
 
     //! Public interface for computing the minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
@@ -108,8 +114,9 @@ class DGPDE {
                  const tk::Fields& geoFace,
                  const tk::Fields& geoElem,
                  const tk::Fields& limFunc,
-                 const tk::Fields& U ) const
-    { return self->dt( coord, inpoel, fd, geoFace, geoElem, limFunc, U ); }
+                 const tk::Fields& U,
+                 std::vector< tk::real >& dte ) const
+    { return self->dt( coord, inpoel, fd, geoFace, geoElem, limFunc, U, dte ); }
 
     //! \brief Public interface for collecting all side set IDs the user has
     //!   configured for all components of a PDE system
@@ -168,6 +175,8 @@ class DGPDE {
                                const std::size_t nielem ) const = 0;
       virtual void lhs( const tk::Fields&, tk::Fields& ) const = 0;
       virtual void rhs( tk::real,
+                        const tk::Fields&,
+                        const tk::Fields&,
                         const tk::Fields&,
                         const tk::Fields&,
                         const inciter::FaceData&,
@@ -175,6 +184,9 @@ class DGPDE {
                         const tk::UnsMesh::Coords&,
                         const tk::Fields&,
                         const tk::Fields&,
+                        const std::vector< std::size_t >&,
+                        const std::vector< tk::real >&,
+                        const std::vector< tk::real >&,
                         tk::Fields& ) const = 0;
       virtual tk::real dt( const std::array< std::vector< tk::real >, 3 >&,
                            const std::vector< std::size_t >&,
@@ -182,7 +194,8 @@ class DGPDE {
                            const tk::Fields&,
                            const tk::Fields&,
                            const tk::Fields&,
-                           const tk::Fields& ) const = 0;
+                           const tk::Fields&,
+                           std::vector< tk::real >& ) const = 0;
       virtual void side( std::unordered_set< int >& conf ) const = 0;
       virtual std::vector< std::string > fieldNames() const = 0;
       virtual std::vector< std::string > names() const = 0;
@@ -218,21 +231,29 @@ class DGPDE {
       void rhs( tk::real t,
                 const tk::Fields& geoFace,
                 const tk::Fields& geoElem,
+                const tk::Fields& geoFaceGp,
+                const tk::Fields& geoElemGp,
                 const inciter::FaceData& fd,
                 const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const tk::Fields& U,
                 const tk::Fields& limFunc,
+                const std::vector< std::size_t >& ndofel,
+                const std::vector< tk::real >& fw,
+                const std::vector< tk::real >& ew,
                 tk::Fields& R ) const override
-      { data.rhs( t, geoFace, geoElem, fd, inpoel, coord, U, limFunc, R ); }
+      { data.rhs( t, geoFace, geoElem, geoFaceGp, geoElemGp, fd, inpoel, coord,
+                  U, limFunc, ndofel, fw, ew, R ); }
       tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                    const std::vector< std::size_t >& inpoel,
                    const inciter::FaceData& fd,
                    const tk::Fields& geoFace,
                    const tk::Fields& geoElem,
                    const tk::Fields& limFunc,
-                   const tk::Fields& U ) const override
-      { return data.dt( coord, inpoel, fd, geoFace, geoElem, limFunc, U ); }
+                   const tk::Fields& U,
+                   std::vector< tk::real >& dte ) const override
+      { return data.dt( coord, inpoel, fd, geoFace, geoElem, limFunc, U,
+                        dte ); }
       void side( std::unordered_set< int >& conf ) const override
       { data.side( conf ); }
       std::vector< std::string > fieldNames() const override
@@ -15,6 +15,7 @@
 #ifndef FunctionPrototypes_h
 #define FunctionPrototypes_h
 
+#include <array>
 #include <vector>
 #include <functional>
 
@@ -61,6 +62,61 @@ using VelFn = std::function<
   std::vector< std::array< tk::real, 3 > >
   ( ncomp_t, ncomp_t, real, real, real ) >;
 
+//! Function prototype for batched Riemann flux functions
+//! \details Functions of this type compute numerical fluxes across a surface
+//!    at ng points at once, e.g., all quadrature points of a face, writing
+//!    into caller-provided storage without allocating. Arguments: face normal,
+//!    number of points ng, number of scalar components ncomp, left and right
+//!    states (ng x ncomp), prescribed velocities (ng x ncomp), and the fluxes
+//!    computed (ng x ncomp), all point-major.
+//! \note The DG integrators, e.g., tk::surfInt(), take the Riemann solver as
+//!   a template argument, thus the call is resolved at compile time.
+//! \see e.g., inciter::Upwind::fluxBatch, inciter::HLLC::fluxBatch
+using RiemannFluxBatchFn =
+  void( const std::array< real, 3 >&, std::size_t, std::size_t,
+        const real*, const real*, const std::array< real, 3 >*, real* );
+
+//! Number of faces processed at once by face-batched Riemann solvers
+//! \details Eight double-precision lanes fill one AVX-512 or two AVX2
+//!   registers. Face-batched kernels are written as loops over this
+//!   compile-time number of lanes, which compilers vectorize.
+constexpr std::size_t RiemannLanes = 8;
+
+//! Function prototype for face-batched Riemann flux functions
+//! \details Functions of this type compute numerical fluxes at one point on
+//!   each of RiemannLanes faces at once from structure-of-arrays data, lane k
+//!   of component c stored at [c*RiemannLanes+k]. Arguments: number of scalar
+//!   components ncomp, face normals (3 x RiemannLanes), left and right states
+//!   (ncomp x RiemannLanes), prescribed velocities (3*ncomp x RiemannLanes),
+//!   and the Riemann fluxes computed (ncomp x RiemannLanes). All lanes are
+//!   computed, the caller pads unused lanes with valid states.
+//! \see e.g., inciter::HLLC::fluxFaces, inciter::LaxFriedrichs::fluxFaces
+using RiemannFluxFacesFn =
+  void( std::size_t, const real*, const real*, const real*, const real*,
+        real* );
+
+//! Function prototype for batched flux vector functions
+//! \details Functions of this type compute the physical flux functions of the
+//!   PDEs at ng points at once writing into caller-provided storage without
+//!   allocating. Arguments: equation system index, number of scalar
+//!   components ncomp, number of points ng, solution (ng x ncomp), prescribed
+//!   velocities (ng x ncomp), and the flux vectors computed (ng x ncomp), all
+//!   point-major.
+//! \note The DG integrators, e.g., tk::volInt(), take the flux function as a
+//!   template argument, thus the call is resolved at compile time.
+//! \see e.g., inciter::dg::CompFlow::flux
+using FluxBatchFn =
+  void( ncomp_t, ncomp_t, std::size_t, const real*,
+        const std::array< real, 3 >*, std::array< real, 3 >* );
+
+//! \brief Function prototype for evaluating a prescribed velocity field into
+//!   caller-provided storage
+//! \details Arguments: equation system index, number of scalar components
+//!   ncomp, x, y, z coordinates, and the velocities computed for all ncomp
+//!   components.
+using VelBufferFn =
+  void( ncomp_t, ncomp_t, real, real, real, std::array< real, 3 >* );
+
 //! Function prototype for physical boundary states
 //! \details Functions of this type are used to provide the left and right
 //!    states of boundary faces along physical boundaries
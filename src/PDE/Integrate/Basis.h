@@ -72,6 +72,18 @@ eval_state ( ncomp_t ncomp,
              const Fields& limFunc,
              const std::vector< tk::real >& B );
 
+//! Compute the state variables for the tetrahedron element into a buffer
+void
+eval_state ( ncomp_t ncomp,
+             ncomp_t offset,
+             const std::size_t ndof,
+             const std::size_t ndofel,
+             const std::size_t e,
+             const Fields& U,
+             const Fields& limFunc,
+             const tk::real* B,
+             tk::real* state );
+
 } // tk::
 
 #endif // Basis_h
@@ -15,20 +15,80 @@
 #ifndef Boundary_h
 #define Boundary_h
 
+#include <array>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <algorithm>
+
 #include "Basis.h"
 #include "Surface.h"
 #include "Types.h"
 #include "Fields.h"
 #include "FaceData.h"
 #include "UnsMesh.h"
+#include "Quadrature.h"
+#include "Cache.h"
 #include "FunctionPrototypes.h"
+#include "Inciter/InputDeck/InputDeck.h"
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+} // inciter::
 
 namespace tk {
 
 using ncomp_t = kw::ncomp::info::expect::type;
 using bcconf_t = kw::sideset::info::expect::type;
 
+//! Update the rhs by adding the boundary surface integration term
+void
+update_rhs_bc ( ncomp_t ncomp,
+                ncomp_t offset,
+                const std::size_t ndof,
+                const std::size_t ndof_l,
+                const tk::real wt,
+                const std::size_t el,
+                const tk::real* fl,
+                const tk::real* B_l,
+                Fields& R );
+
 //! Compute boundary surface flux integrals for a given boundary type for DG
+//! \tparam Riemann Riemann solver type providing fluxBatch() following
+//!   tk::RiemannFluxBatchFn, e.g., inciter::HLLC or inciter::RiemannSolver
+//! \tparam Vel Prescribed velocity function type following tk::VelBufferFn
+//! \details This function computes contributions from surface integrals along
+//!   all faces for a particular boundary condition type, configured by the state
+//!   function. The Riemann solver and velocity function are resolved at
+//!   compile time, the Riemann flux is evaluated for all quadrature points of
+//!   a face at once.
+//! \param[in] system Equation system index
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \param[in] offset Offset this PDE system operates from
+//! \param[in] bcconfig BC configuration vector for multiple side sets
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] geoFace Face geometry array
+//! \param[in] geoFaceGp Face quadrature-point data (if cached, empty if not),
+//!   see tk::genGeoFaceGp()
+//! \param[in] inpoel Element-node connectivity
+//! \param[in] coord Array of nodal coordinates
+//! \param[in] t Physical time
+//! \param[in] riemann Riemann solver to use
+//! \param[in] vel Function to use to query prescribed velocity (if any)
+//! \param[in] state Function to evaluate the left and right solution state at
+//!   boundaries
+//! \param[in] U Solution vector at recent time step
+//! \param[in] limFunc Limiter function for higher-order solution dofs
+//! \param[in] ndofel Number of degrees of freedom active on each element. If
+//!   empty, all ndof degrees of freedom are active on all elements.
+//! \param[in] fw Face weights multiplying the surface integrals, two per
+//!   face, of which the first one applies to the (left) element of a boundary
+//!   face. If empty, all faces are integrated with unit weight, otherwise faces
+//!   with zero weight are skipped.
+//! \param[in,out] R Right-hand side vector computed
+template< class Riemann, class Vel >
 void
 bndSurfInt( ncomp_t system,
             ncomp_t ncomp,
@@ -36,26 +96,117 @@ bndSurfInt( ncomp_t system,
             const std::vector< bcconf_t >& bcconfig,
             const inciter::FaceData& fd,
             const Fields& geoFace,
+            const Fields& geoFaceGp,
             const std::vector< std::size_t >& inpoel,
             const UnsMesh::Coords& coord,
             real t,
-            const RiemannFluxFn& flux,
-            const VelFn& vel,
+            const Riemann& riemann,
+            const Vel& vel,
             const StateFn& state,
             const Fields& U,
             const Fields& limFunc,
-            Fields& R );
+            const std::vector< std::size_t >& ndofel,
+            const std::vector< real >& fw,
+            Fields& R )
+{
+  const auto& bface = fd.Bface();
+  const auto& esuf = fd.Esuf();
+  const auto& inpofa = fd.Inpofa();
+  const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
+
+  // Number of quadrature points for face integration
+  auto ng = tk::NGfa(ndof);
+
+  // arrays for quadrature points
+  std::array< std::vector< real >, 2 > coordgp;
+  std::vector< real > wgp;
+
+  coordgp[0].resize( ng );
+  coordgp[1].resize( ng );
+  wgp.resize( ng );
+
+  // get quadrature point weights and coordinates for triangle
+  GaussQuadratureTri( ng, coordgp, wgp );
+
+  // Use precomputed quadrature-point data if available
+  const auto cached = geoFaceGp.nunk() > 0;
+  const auto stride = gpFaceStride( ndof );
+  Assert( !cached || (geoFaceGp.nunk() == esuf.size()/2 &&
+                      geoFaceGp.nprop() == ng*stride),
+          "Size mismatch in cached face quadrature-point data" );
+
+  // Work arrays reused for all faces
+  std::vector< real > gpdata( cached ? 0 : ng*stride );
+  std::vector< real > ugp( ncomp );
+  std::vector< real > ul( ng*ncomp ), ur( ng*ncomp ), fl( ng*ncomp );
+  std::vector< std::array< real, 3 > > v( ng*ncomp, {{ 0.0, 0.0, 0.0 }} );
+
+  for (const auto& s : bcconfig) {       // for all bc sidesets
+    auto bc = bface.find( std::stoi(s) );// faces for side set
+    if (bc != end(bface))
+    {
+      for (const auto& f : bc->second)
+      {
+        Assert( esuf[2*f+1] == -1, "outside boundary element not -1" );
+
+        const auto w = fw.empty() ? 1.0 : fw[2*f];
+        if (!(std::abs(w) > 0.0)) continue;
+
+        std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+        const auto nd = ndofel.empty() ? ndof : ndofel[el];
+
+        // Quadrature point coordinates and left basis functions
+        const real* g = nullptr;
+        if (cached) {
+          g = &geoFaceGp(f,0,0);
+        } else {
+          evalGeoFaceGp( f, ndof, coordgp, esuf, inpofa, inpoel, coord,
+                         gpdata.data() );
+          g = gpdata.data();
+        }
+
+        std::array< real, 3 >
+          fn{{ geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) }};
+
+        // Evaluate the left and right (boundary) states and prescribed
+        // velocity (if any)
+        for (std::size_t igp=0; igp<ng; ++igp)
+        {
+          const auto x = g + igp*stride;
+
+          // Compute the state variables at the left element
+          eval_state( ncomp, offset, ndof, nd, el, U, limFunc, x+3,
+                      ugp.data() );
+
+          auto lr = state( system, ncomp, ugp, x[0], x[1], x[2], t, fn );
+
+          Assert( lr[0].size() == ncomp && lr[1].size() == ncomp,
+                  "Size mismatch" );
+
+          std::copy( begin(lr[0]), end(lr[0]), ul.begin() + igp*ncomp );
+          std::copy( begin(lr[1]), end(lr[1]), ur.begin() + igp*ncomp );
+
+          vel( system, ncomp, x[0], x[1], x[2], v.data() + igp*ncomp );
+        }
+
+        // Compute the numerical flux at all quadrature points of the face
+        riemann.fluxBatch( fn, ng, ncomp, ul.data(), ur.data(), v.data(),
+                           fl.data() );
+
+        // Gaussian quadrature
+        for (std::size_t igp=0; igp<ng; ++igp)
+        {
+          auto wt = w * wgp[igp] * geoFace(f,0,0);
+
+          // Add the surface integration term to the rhs
+          update_rhs_bc( ncomp, offset, ndof, nd, wt, el,
+                         fl.data() + igp*ncomp, g + igp*stride + 3, R );
+        }
+      }
+    }
+  }
+}
 
-//! Update the rhs by adding the boundary surface integration term
-void
-update_rhs_bc ( ncomp_t ncomp,
-                ncomp_t offset,
-                const std::size_t ndof,
-                const tk::real wt,
-                const std::size_t el,
-                const std::vector< tk::real >& fl,
-                const std::vector< tk::real >& B_l,
-                Fields& R );
 } // tk::
 
 #endif // Boundary_h
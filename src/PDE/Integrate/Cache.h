@@ -0,0 +1,77 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/Integrate/Cache.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Precomputed quadrature-point data for DG volume and surface
+     integrals
+  \details   This file contains functionality for generating the geometry and
+     basis function data evaluated at the quadrature points of mesh elements
+     and faces, used by the discontinuous Galerkin volume and surface
+     integrals. On a static mesh these data do not change between Runge-Kutta
+     stages, thus they can be computed once and reused, trading memory for
+     repeated computation.
+*/
+// *****************************************************************************
+#ifndef Cache_h
+#define Cache_h
+
+#include <array>
+#include <vector>
+
+#include "Types.h"
+#include "Fields.h"
+#include "FaceData.h"
+#include "UnsMesh.h"
+
+namespace tk {
+
+//! Number of cached reals per volume quadrature point
+//! \param[in] ndof Number of degrees of freedom
+//! \return Physical coordinates (3) and basis function derivatives (3*ndof)
+constexpr std::size_t gpElemStride( std::size_t ndof ) { return 3 + 3*ndof; }
+
+//! Number of cached reals per face quadrature point
+//! \param[in] ndof Number of degrees of freedom
+//! \return Physical coordinates (3) and basis functions of the left and right
+//!   elements (2*ndof)
+constexpr std::size_t gpFaceStride( std::size_t ndof ) { return 3 + 2*ndof; }
+
+//! Evaluate quadrature-point data of a single element
+void
+evalGeoElemGp( std::size_t e,
+               std::size_t ndof,
+               const std::array< std::vector< real >, 3 >& coordgp,
+               const std::vector< std::size_t >& inpoel,
+               const UnsMesh::Coords& coord,
+               real* gpdata );
+
+//! Evaluate quadrature-point data of a single face
+void
+evalGeoFaceGp( std::size_t f,
+               std::size_t ndof,
+               const std::array< std::vector< real >, 2 >& coordgp,
+               const std::vector< int >& esuf,
+               const std::vector< std::size_t >& inpofa,
+               const std::vector< std::size_t >& inpoel,
+               const UnsMesh::Coords& coord,
+               real* gpdata );
+
+//! Generate element quadrature-point data for DG volume integrals
+Fields
+genGeoElemGp( std::size_t ndof,
+              const std::vector< std::size_t >& inpoel,
+              const UnsMesh::Coords& coord );
+
+//! Generate face quadrature-point data for DG surface integrals
+Fields
+genGeoFaceGp( std::size_t ndof,
+              const inciter::FaceData& fd,
+              const std::vector< std::size_t >& inpoel,
+              const UnsMesh::Coords& coord );
+
+} // tk::
+
+#endif // Cache_h
@@ -13,6 +13,8 @@
 #ifndef HLLC_h
 #define HLLC_h
 
+#include <array>
+#include <cmath>
 #include <vector>
 
 #include "Types.h"
@@ -45,99 +47,275 @@ struct HLLC {
     // ratio of specific heats
     auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
 
-    // Primitive variables
-    auto rhol = u[0][0];
-    auto rhor = u[1][0];
-
-    auto pl = (g-1.0)*(u[0][4] - (u[0][1]*u[0][1] +
-                                  u[0][2]*u[0][2] +
-                                  u[0][3]*u[0][3]) / (2.0*rhol));
-
-    auto pr = (g-1.0)*(u[1][4] - (u[1][1]*u[1][1] +
-                                  u[1][2]*u[1][2] +
-                                  u[1][3]*u[1][3]) / (2.0*rhor));
-
-    auto al = sqrt(g * pl / rhol);
-    auto ar = sqrt(g * pr / rhor);
-
-    // Face-normal velocities
-    auto ul = u[0][1]/rhol;
-    auto vl = u[0][2]/rhol;
-    auto wl = u[0][3]/rhol;
-
-    tk::real vnl = ul*fn[0] + vl*fn[1] + wl*fn[2];
-
-    auto ur = u[1][1]/rhor;
-    auto vr = u[1][2]/rhor;
-    auto wr = u[1][3]/rhor;
-
-    tk::real vnr = ur*fn[0] + vr*fn[1] + wr*fn[2];
-
-    // Roe-averaged variables
-    auto rlr = sqrt(rhor/rhol);
-    auto rlr1 = 1.0 + rlr;
-
-    auto vnroe = (vnr*rlr + vnl)/rlr1 ;
-    auto aroe = (ar*rlr + al)/rlr1 ;
-
-    // Signal velocities
-    auto Sl = fmin(vnl-al, vnroe-aroe);
-    auto Sr = fmax(vnr+ar, vnroe+aroe);
-    auto Sm = ( rhor*vnr*(Sr-vnr) - rhol*vnl*(Sl-vnl) + pl-pr )
-             /( rhor*(Sr-vnr) - rhol*(Sl-vnl) );
-
-    // Middle-zone (star) variables
-    auto pStar = rhol*(vnl-Sl)*(vnl-Sm) + pl;
-    auto uStar = u;
-
-    uStar[0][0] = (Sl-vnl) * rhol/ (Sl-Sm);
-    uStar[0][1] = ((Sl-vnl) * u[0][1] + (pStar-pl)*fn[0]) / (Sl-Sm);
-    uStar[0][2] = ((Sl-vnl) * u[0][2] + (pStar-pl)*fn[1]) / (Sl-Sm);
-    uStar[0][3] = ((Sl-vnl) * u[0][3] + (pStar-pl)*fn[2]) / (Sl-Sm);
-    uStar[0][4] = ((Sl-vnl) * u[0][4] - pl*vnl + pStar*Sm) / (Sl-Sm);
-
-    uStar[1][0] = (Sr-vnr) * rhor/ (Sr-Sm);
-    uStar[1][1] = ((Sr-vnr) * u[1][1] + (pStar-pr)*fn[0]) / (Sr-Sm);
-    uStar[1][2] = ((Sr-vnr) * u[1][2] + (pStar-pr)*fn[1]) / (Sr-Sm);
-    uStar[1][3] = ((Sr-vnr) * u[1][3] + (pStar-pr)*fn[2]) / (Sr-Sm);
-    uStar[1][4] = ((Sr-vnr) * u[1][4] - pr*vnr + pStar*Sm) / (Sr-Sm);
-
-    // Numerical fluxes
-    if (Sl > 0.0) {
-      flx[0] = u[0][0] * vnl;
-      flx[1] = u[0][1] * vnl + pl*fn[0];
-      flx[2] = u[0][2] * vnl + pl*fn[1];
-      flx[3] = u[0][3] * vnl + pl*fn[2];
-      flx[4] = ( u[0][4] + pl ) * vnl;
-    }
-    else if (Sl <= 0.0 && Sm > 0.0) {
-      flx[0] = uStar[0][0] * Sm;
-      flx[1] = uStar[0][1] * Sm + pStar*fn[0];
-      flx[2] = uStar[0][2] * Sm + pStar*fn[1];
-      flx[3] = uStar[0][3] * Sm + pStar*fn[2];
-      flx[4] = ( uStar[0][4] + pStar ) * Sm;
-    }
-    else if (Sm <= 0.0 && Sr >= 0.0) {
-      flx[0] = uStar[1][0] * Sm;
-      flx[1] = uStar[1][1] * Sm + pStar*fn[0];
-      flx[2] = uStar[1][2] * Sm + pStar*fn[1];
-      flx[3] = uStar[1][3] * Sm + pStar*fn[2];
-      flx[4] = ( uStar[1][4] + pStar ) * Sm;
+    point( g, fn, u[0].data(), u[1].data(), flx.data() );
+
+    return flx;
+  }
+
+  //! HLLC approximate Riemann solver flux function for a batch of points
+  //! \param[in] fn Face/Surface normal
+  //! \param[in] ng Number of points, e.g., quadrature points on a face
+  //! \param[in] ncomp Number of scalar components
+  //! \param[in] ul Left states, ng x ncomp, point-major
+  //! \param[in] ur Right states, ng x ncomp, point-major
+  //! \param[in,out] fl Riemann fluxes computed, ng x ncomp, point-major
+  //! \note Does not allocate and produces the same result as flux() for
+  //!   each point
+  static void
+  fluxBatch( const std::array< tk::real, 3 >& fn,
+             std::size_t ng,
+             std::size_t ncomp,
+             const tk::real* ul,
+             const tk::real* ur,
+             const std::array< tk::real, 3 >*,
+             tk::real* fl )
+  {
+    // ratio of specific heats
+    auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
+
+    for (std::size_t i=0; i<ng; ++i) {
+      auto f = fl + i*ncomp;
+      for (std::size_t c=5; c<ncomp; ++c) f[c] = 0.0;
+      point( g, fn, ul + i*ncomp, ur + i*ncomp, f );
     }
-    else {
-      flx[0] = u[1][0] * vnr;
-      flx[1] = u[1][1] * vnr + pr*fn[0];
-      flx[2] = u[1][2] * vnr + pr*fn[1];
-      flx[3] = u[1][3] * vnr + pr*fn[2];
-      flx[4] = ( u[1][4] + pr ) * vnr;
+  }
+
+  //! HLLC approximate Riemann solver flux function for a batch of faces
+  //! \param[in] ncomp Number of scalar components
+  //! \param[in] fn Face normals, 3 x tk::RiemannLanes
+  //! \param[in] ul Left states, ncomp x tk::RiemannLanes
+  //! \param[in] ur Right states, ncomp x tk::RiemannLanes
+  //! \param[in,out] fl Riemann fluxes computed, ncomp x tk::RiemannLanes
+  //! \details The fluxes of all four wave regions are computed for all lanes
+  //!   first, then the flux of the wave region is selected, replacing the
+  //!   branches of point(), so that both loops over the lanes vectorize. The
+  //!   arithmetic of each region is the same as in point(), thus each lane
+  //!   reproduces flux().
+  //! \note The function signature must follow tk::RiemannFluxFacesFn
+  static void
+  fluxFaces( std::size_t ncomp,
+             const tk::real* fn,
+             const tk::real* ul,
+             const tk::real* ur,
+             const tk::real*,
+             tk::real* fl )
+  {
+    constexpr auto W = tk::RiemannLanes;
+
+    // ratio of specific heats
+    auto g = g_inputdeck.get< tag::param, tag::compflow, tag::gamma >()[0];
+
+    // Signal velocities and fluxes of the left, left-star, right-star, and
+    // right wave regions
+    tk::real Sl[W], Sm[W], Sr[W];
+    tk::real fL[5][W], fSl[5][W], fSr[5][W], fR[5][W];
+
+    for (std::size_t k=0; k<W; ++k) {
+      auto nx = fn[k];
+      auto ny = fn[W+k];
+      auto nz = fn[2*W+k];
+
+      auto ul0 = ul[k], ul1 = ul[W+k], ul2 = ul[2*W+k], ul3 = ul[3*W+k],
+           ul4 = ul[4*W+k];
+      auto ur0 = ur[k], ur1 = ur[W+k], ur2 = ur[2*W+k], ur3 = ur[3*W+k],
+           ur4 = ur[4*W+k];
+
+      // Primitive variables
+      auto rhol = ul0;
+      auto rhor = ur0;
+
+      auto pl = (g-1.0)*(ul4 - (ul1*ul1 + ul2*ul2 + ul3*ul3) / (2.0*rhol));
+      auto pr = (g-1.0)*(ur4 - (ur1*ur1 + ur2*ur2 + ur3*ur3) / (2.0*rhor));
+
+      auto al = sqrt(g * pl / rhol);
+      auto ar = sqrt(g * pr / rhor);
+
+      // Face-normal velocities
+      tk::real vnl = ul1/rhol*nx + ul2/rhol*ny + ul3/rhol*nz;
+      tk::real vnr = ur1/rhor*nx + ur2/rhor*ny + ur3/rhor*nz;
+
+      // Roe-averaged variables
+      auto rlr = sqrt(rhor/rhol);
+      auto rlr1 = 1.0 + rlr;
+
+      auto vnroe = (vnr*rlr + vnl)/rlr1 ;
+      auto aroe = (ar*rlr + al)/rlr1 ;
+
+      // Signal velocities, min/max as selects, which vectorize unlike
+      // fmin/fmax
+      auto sl1 = vnl-al, sl2 = vnroe-aroe;
+      auto sr1 = vnr+ar, sr2 = vnroe+aroe;
+      auto sl = sl2 < sl1 ? sl2 : sl1;
+      auto sr = sr2 > sr1 ? sr2 : sr1;
+      auto sm = ( rhor*vnr*(sr-vnr) - rhol*vnl*(sl-vnl) + pl-pr )
+               /( rhor*(sr-vnr) - rhol*(sl-vnl) );
+
+      // Middle-zone (star) variables
+      auto pStar = rhol*(vnl-sl)*(vnl-sm) + pl;
+
+      // Left and right star states
+      auto usl0 = (sl-vnl) * rhol/ (sl-sm);
+      auto usl1 = ((sl-vnl) * ul1 + (pStar-pl)*nx) / (sl-sm);
+      auto usl2 = ((sl-vnl) * ul2 + (pStar-pl)*ny) / (sl-sm);
+      auto usl3 = ((sl-vnl) * ul3 + (pStar-pl)*nz) / (sl-sm);
+      auto usl4 = ((sl-vnl) * ul4 - pl*vnl + pStar*sm) / (sl-sm);
+
+      auto usr0 = (sr-vnr) * rhor/ (sr-sm);
+      auto usr1 = ((sr-vnr) * ur1 + (pStar-pr)*nx) / (sr-sm);
+      auto usr2 = ((sr-vnr) * ur2 + (pStar-pr)*ny) / (sr-sm);
+      auto usr3 = ((sr-vnr) * ur3 + (pStar-pr)*nz) / (sr-sm);
+      auto usr4 = ((sr-vnr) * ur4 - pr*vnr + pStar*sm) / (sr-sm);
+
+      Sl[k] = sl;
+      Sm[k] = sm;
+      Sr[k] = sr;
+
+      fL[0][k] = ul0 * vnl;
+      fL[1][k] = ul1 * vnl + pl*nx;
+      fL[2][k] = ul2 * vnl + pl*ny;
+      fL[3][k] = ul3 * vnl + pl*nz;
+      fL[4][k] = ( ul4 + pl ) * vnl;
+
+      fSl[0][k] = usl0 * sm;
+      fSl[1][k] = usl1 * sm + pStar*nx;
+      fSl[2][k] = usl2 * sm + pStar*ny;
+      fSl[3][k] = usl3 * sm + pStar*nz;
+      fSl[4][k] = ( usl4 + pStar ) * sm;
+
+      fSr[0][k] = usr0 * sm;
+      fSr[1][k] = usr1 * sm + pStar*nx;
+      fSr[2][k] = usr2 * sm + pStar*ny;
+      fSr[3][k] = usr3 * sm + pStar*nz;
+      fSr[4][k] = ( usr4 + pStar ) * sm;
+
+      fR[0][k] = ur0 * vnr;
+      fR[1][k] = ur1 * vnr + pr*nx;
+      fR[2][k] = ur2 * vnr + pr*ny;
+      fR[3][k] = ur3 * vnr + pr*nz;
+      fR[4][k] = ( ur4 + pr ) * vnr;
     }
 
-    return flx;
+    // Numerical fluxes: select the wave region in the same order as point()
+    for (std::size_t c=0; c<5; ++c)
+      for (std::size_t k=0; k<W; ++k) {
+        auto left = fL[c][k], starl = fSl[c][k], starr = fSr[c][k],
+             right = fR[c][k];
+        auto f = Sm[k] <= 0.0 && Sr[k] >= 0.0 ? starr : right;
+        f = Sl[k] <= 0.0 && Sm[k] > 0.0 ? starl : f;
+        fl[c*W+k] = Sl[k] > 0.0 ? left : f;
+      }
+
+    for (std::size_t c=5; c<ncomp; ++c)
+      for (std::size_t k=0; k<W; ++k)
+        fl[c*W+k] = 0.0;
   }
 
   //! Flux type accessor
   //! \return Flux type
   static ctr::FluxType type() noexcept { return ctr::FluxType::HLLC; }
+
+  private:
+    //! HLLC approximate Riemann solver flux at a single point
+    //! \param[in] g Ratio of specific heats
+    //! \param[in] fn Face/Surface normal
+    //! \param[in] ul Left state
+    //! \param[in] ur Right state
+    //! \param[in,out] flx Riemann flux computed for the first 5 components
+    static void
+    point( tk::real g,
+           const std::array< tk::real, 3 >& fn,
+           const tk::real* ul,
+           const tk::real* ur,
+           tk::real* flx )
+    {
+      // Primitive variables
+      auto rhol = ul[0];
+      auto rhor = ur[0];
+
+      auto pl = (g-1.0)*(ul[4] - (ul[1]*ul[1] +
+                                  ul[2]*ul[2] +
+                                  ul[3]*ul[3]) / (2.0*rhol));
+
+      auto pr = (g-1.0)*(ur[4] - (ur[1]*ur[1] +
+                                  ur[2]*ur[2] +
+                                  ur[3]*ur[3]) / (2.0*rhor));
+
+      auto al = sqrt(g * pl / rhol);
+      auto ar = sqrt(g * pr / rhor);
+
+      // Face-normal velocities
+      auto u_l = ul[1]/rhol;
+      auto v_l = ul[2]/rhol;
+      auto w_l = ul[3]/rhol;
+
+      tk::real vnl = u_l*fn[0] + v_l*fn[1] + w_l*fn[2];
+
+      auto u_r = ur[1]/rhor;
+      auto v_r = ur[2]/rhor;
+      auto w_r = ur[3]/rhor;
+
+      tk::real vnr = u_r*fn[0] + v_r*fn[1] + w_r*fn[2];
+
+      // Roe-averaged variables
+      auto rlr = sqrt(rhor/rhol);
+      auto rlr1 = 1.0 + rlr;
+
+      auto vnroe = (vnr*rlr + vnl)/rlr1 ;
+      auto aroe = (ar*rlr + al)/rlr1 ;
+
+      // Signal velocities
+      auto Sl = fmin(vnl-al, vnroe-aroe);
+      auto Sr = fmax(vnr+ar, vnroe+aroe);
+      auto Sm = ( rhor*vnr*(Sr-vnr) - rhol*vnl*(Sl-vnl) + pl-pr )
+               /( rhor*(Sr-vnr) - rhol*(Sl-vnl) );
+
+      // Middle-zone (star) variables
+      auto pStar = rhol*(vnl-Sl)*(vnl-Sm) + pl;
+
+      // Numerical fluxes
+      if (Sl > 0.0) {
+        flx[0] = ul[0] * vnl;
+        flx[1] = ul[1] * vnl + pl*fn[0];
+        flx[2] = ul[2] * vnl + pl*fn[1];
+        flx[3] = ul[3] * vnl + pl*fn[2];
+        flx[4] = ( ul[4] + pl ) * vnl;
+      }
+      else if (Sl <= 0.0 && Sm > 0.0) {
+        tk::real uStar[5];
+        uStar[0] = (Sl-vnl) * rhol/ (Sl-Sm);
+        uStar[1] = ((Sl-vnl) * ul[1] + (pStar-pl)*fn[0]) / (Sl-Sm);
+        uStar[2] = ((Sl-vnl) * ul[2] + (pStar-pl)*fn[1]) / (Sl-Sm);
+        uStar[3] = ((Sl-vnl) * ul[3] + (pStar-pl)*fn[2]) / (Sl-Sm);
+        uStar[4] = ((Sl-vnl) * ul[4] - pl*vnl + pStar*Sm) / (Sl-Sm);
+
+        flx[0] = uStar[0] * Sm;
+        flx[1] = uStar[1] * Sm + pStar*fn[0];
+        flx[2] = uStar[2] * Sm + pStar*fn[1];
+        flx[3] = uStar[3] * Sm + pStar*fn[2];
+        flx[4] = ( uStar[4] + pStar ) * Sm;
+      }
+      else if (Sm <= 0.0 && Sr >= 0.0) {
+        tk::real uStar[5];
+        uStar[0] = (Sr-vnr) * rhor/ (Sr-Sm);
+        uStar[1] = ((Sr-vnr) * ur[1] + (pStar-pr)*fn[0]) / (Sr-Sm);
+        uStar[2] = ((Sr-vnr) * ur[2] + (pStar-pr)*fn[1]) / (Sr-Sm);
+        uStar[3] = ((Sr-vnr) * ur[3] + (pStar-pr)*fn[2]) / (Sr-Sm);
+        uStar[4] = ((Sr-vnr) * ur[4] - pr*vnr + pStar*Sm) / (Sr-Sm);
+
+        flx[0] = uStar[0] * Sm;
+        flx[1] = uStar[1] * Sm + pStar*fn[0];
+        flx[2] = uStar[2] * Sm + pStar*fn[1];
+        flx[3] = uStar[3] * Sm + pStar*fn[2];
+        flx[4] = ( uStar[4] + pStar ) * Sm;
+      }
+      else {
+        flx[0] = ur[0] * vnr;
+        flx[1] = ur[1] * vnr + pr*fn[0];
+        flx[2] = ur[2] * vnr + pr*fn[1];
+        flx[3] = ur[3] * vnr + pr*fn[2];
+        flx[4] = ( ur[4] + pr ) * vnr;
+      }
+    }
 };
 
 } // inciter::
@@ -77,6 +77,32 @@ class RiemannSolver {
           const std::vector< std::array< tk::real, 3 > >& v ) const
     { return self->flux( fn, u, v ); }
 
+    //! Public interface to computing the Riemann flux for a batch of points
+    //! \details A single virtual call is made for all ng points, the loop
+    //!   over the points is compiled for the concrete Riemann solver type.
+    //! \see e.g., inciter::HLLC::fluxBatch()
+    void
+    fluxBatch( const std::array< tk::real, 3 >& fn,
+               std::size_t ng,
+               std::size_t ncomp,
+               const tk::real* ul,
+               const tk::real* ur,
+               const std::array< tk::real, 3 >* v,
+               tk::real* fl ) const
+    { self->fluxBatch( fn, ng, ncomp, ul, ur, v, fl ); }
+
+    //! Public interface to computing the Riemann flux for a batch of faces
+    //! \details A single virtual call is made for tk::RiemannLanes faces.
+    //! \see e.g., inciter::HLLC::fluxFaces()
+    void
+    fluxFaces( std::size_t ncomp,
+               const tk::real* fn,
+               const tk::real* ul,
+               const tk::real* ur,
+               const tk::real* v,
+               tk::real* fl ) const
+    { self->fluxFaces( ncomp, fn, ul, ur, v, fl ); }
+
     //! Copy assignment
     RiemannSolver& operator=( const RiemannSolver& x )
     { RiemannSolver tmp(x); *this = std::move(tmp); return *this; }
@@ -100,6 +126,21 @@ class RiemannSolver {
         flux( const std::array< tk::real, 3 >&,
               const std::array< std::vector< tk::real >, 2 >&,
               const std::vector< std::array< tk::real, 3 > >& ) const = 0;
+      virtual void
+        fluxBatch( const std::array< tk::real, 3 >&,
+                   std::size_t,
+                   std::size_t,
+                   const tk::real*,
+                   const tk::real*,
+                   const std::array< tk::real, 3 >*,
+                   tk::real* ) const = 0;
+      virtual void
+        fluxFaces( std::size_t,
+                   const tk::real*,
+                   const tk::real*,
+                   const tk::real*,
+                   const tk::real*,
+                   tk::real* ) const = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -113,6 +154,23 @@ class RiemannSolver {
               const std::array< std::vector< tk::real >, 2 >& u,
               const std::vector< std::array< tk::real, 3 > >& v ) const override
       { return data.flux( fn, u, v ); }
+      void
+        fluxBatch( const std::array< tk::real, 3 >& fn,
+                   std::size_t ng,
+                   std::size_t ncomp,
+                   const tk::real* ul,
+                   const tk::real* ur,
+                   const std::array< tk::real, 3 >* v,
+                   tk::real* fl ) const override
+      { data.fluxBatch( fn, ng, ncomp, ul, ur, v, fl ); }
+      void
+        fluxFaces( std::size_t ncomp,
+                   const tk::real* fn,
+                   const tk::real* ul,
+                   const tk::real* ur,
+                   const tk::real* v,
+                   tk::real* fl ) const override
+      { data.fluxFaces( ncomp, fn, ul, ur, v, fl ); }
       T data;
     };
 
@@ -35,6 +35,8 @@ srcInt( ncomp_t system,
         const UnsMesh::Coords& coord,
         const Fields& geoElem,
         const SrcFn& src,
+        const std::vector< std::size_t >& ndofel,
+        const std::vector< real >& ew,
         Fields& R );
 
 //! Update the rhs by adding the source term integrals
@@ -42,6 +44,7 @@ void
 update_rhs( ncomp_t ncomp,
             ncomp_t offset,
             const std::size_t ndof,
+            const std::size_t ndofel,
             const tk::real wt,
             const std::size_t e,
             const std::vector< tk::real >& B,
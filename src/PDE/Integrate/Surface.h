@@ -15,19 +15,86 @@
 #ifndef Surface_h
 #define Surface_h
 
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "Basis.h"
 #include "Types.h"
 #include "Fields.h"
 #include "FaceData.h"
 #include "UnsMesh.h"
+#include "Quadrature.h"
+#include "Cache.h"
 #include "FunctionPrototypes.h"
+#include "ThreadPool.h"
+#include "Inciter/InputDeck/InputDeck.h"
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+} // inciter::
 
 namespace tk {
 
 using ncomp_t = kw::ncomp::info::expect::type;
 using bcconf_t = kw::sideset::info::expect::type;
 
+// Update the rhs by adding surface integration term
+void
+update_rhs_fa ( ncomp_t ncomp,
+                ncomp_t offset,
+                const std::size_t ndof,
+                const std::size_t ndof_l,
+                const std::size_t ndof_r,
+                const tk::real wt_l,
+                const tk::real wt_r,
+                const std::size_t el,
+                const std::size_t er,
+                const tk::real* fl,
+                const tk::real* B_l,
+                const tk::real* B_r,
+                Fields& R );
+
 //! Compute internal surface flux integrals for DG
+//! \tparam Riemann Riemann solver type providing fluxFaces() following
+//!   tk::RiemannFluxFacesFn, e.g., inciter::HLLC or inciter::RiemannSolver
+//! \tparam Vel Prescribed velocity function type following tk::VelBufferFn
+//! \param[in] system Equation system index
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \param[in] offset Offset this PDE system operates from
+//! \param[in] inpoel Element-node connectivity
+//! \param[in] coord Array of nodal coordinates
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] geoFace Face geometry array
+//! \param[in] geoFaceGp Face quadrature-point data (if cached, empty if not),
+//!   see tk::genGeoFaceGp()
+//! \param[in] riemann Riemann solver to use
+//! \param[in] vel Function to use to query prescribed velocity (if any)
+//! \param[in] U Solution vector at recent time step
+//! \param[in] limFunc Limiter function for higher-order solution dofs
+//! \param[in] ndofel Number of degrees of freedom active on each element. If
+//!   empty, all ndof degrees of freedom are active on all elements.
+//! \param[in] fw Face weights multiplying the surface integrals, two per
+//!   face, applied to the contributions to the left and right element of the
+//!   face, respectively. If empty, all faces are integrated with unit weight,
+//!   otherwise faces with both weights zero are skipped, see inciter::ltsWeights().
+//! \param[in,out] R Right-hand side vector computed
+//! \details The Riemann solver and velocity function are template arguments,
+//!   thus they are resolved at compile time. The interior faces are processed
+//!   in batches of tk::RiemannLanes faces: the left and right states at a
+//!   quadrature point of all faces in a batch are gathered into
+//!   structure-of-arrays work arrays, allocated once per call, and the Riemann
+//!   fluxes are computed for the batch at once. If multiple threads are
+//!   configured and the faces have been colored, see
+//!   inciter::FaceData::colorFaces(), the chunks of faces of a color are
+//!   integrated concurrently, each with its own work arrays. Since faces of the
+//!   same color share no element, the rhs is accumulated without data races
+//!   and in an order independent of the number of threads.
+template< class Riemann, class Vel >
 void
 surfInt( ncomp_t system,
          ncomp_t ncomp,
@@ -36,24 +103,173 @@ surfInt( ncomp_t system,
          const UnsMesh::Coords& coord,
          const inciter::FaceData& fd,
          const Fields& geoFace,
-         const RiemannFluxFn& flux,
-         const VelFn& vel,
+         const Fields& geoFaceGp,
+         const Riemann& riemann,
+         const Vel& vel,
          const Fields& U,
          const Fields& limFunc,
-         Fields& R );
+         const std::vector< std::size_t >& ndofel,
+         const std::vector< real >& fw,
+         Fields& R )
+{
+  const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto nthread = inciter::g_inputdeck.get< tag::discr, tag::nthread >();
+  const auto& esuf = fd.Esuf();
+  const auto& inpofa = fd.Inpofa();
 
-// Update the rhs by adding surface integration term
-void
-update_rhs_fa ( ncomp_t ncomp,
-                ncomp_t offset,
-                const std::size_t ndof,
-                const tk::real wt,
-                const std::size_t el,
-                const std::size_t er,
-                const std::vector< tk::real >& fl,
-                const std::vector< tk::real >& B_l,
-                const std::vector< tk::real >& B_r,
-                Fields& R );
+  // Number of quadrature points for face integration
+  auto ng = tk::NGfa(ndof);
+
+  // arrays for quadrature points
+  std::array< std::vector< real >, 2 > coordgp;
+  std::vector< real > wgp;
+
+  coordgp[0].resize( ng );
+  coordgp[1].resize( ng );
+  wgp.resize( ng );
+
+  // get quadrature point weights and coordinates for triangle
+  GaussQuadratureTri( ng, coordgp, wgp );
+
+  // Use precomputed quadrature-point data if available
+  const auto cached = geoFaceGp.nunk() > 0;
+  const auto stride = gpFaceStride( ndof );
+  Assert( !cached || (geoFaceGp.nunk() == esuf.size()/2 &&
+                      geoFaceGp.nprop() == ng*stride),
+          "Size mismatch in cached face quadrature-point data" );
+
+  constexpr auto W = RiemannLanes;
+
+  const auto nfac = esuf.size()/2;
+  const auto nbfac = fd.Nbfac();
+  Assert( fw.empty() || fw.size() == 2*nfac,
+          "Size mismatch in face weights" );
+  auto nd = [&]( std::size_t e ){ return ndofel.empty() ? ndof : ndofel[e]; };
+
+  // Compute internal surface flux integrals of a list of faces in batches of
+  // W faces
+  auto integrate = [&]( const std::vector< std::size_t >& face )
+  {
+    const auto nact = face.size();
+
+    // Work arrays reused for all batches of faces
+    std::vector< real > gpdata( cached ? 0 : W*ng*stride );
+    std::vector< real > state( ncomp ), flx( ncomp );
+    std::vector< std::array< real, 3 > > vel_gp( ncomp, {{ 0.0, 0.0, 0.0 }} );
+    std::vector< real > fn( 3*W ), ul( ncomp*W ), ur( ncomp*W ),
+                        v( 3*ncomp*W, 0.0 ), fl( ng*ncomp*W );
+    std::array< const real*, W > g;
+
+    for (std::size_t f0=0; f0<nact; f0+=W)
+    {
+      const auto nf = std::min( W, nact-f0 );
+
+      // Face normals and quadrature point coordinates and left and right
+      // basis functions of the faces in the batch
+      for (std::size_t k=0; k<nf; ++k)
+      {
+        const auto f = face[f0+k];
+        Assert( esuf[2*f] > -1 && esuf[2*f+1] > -1, "Interior element detected "
+                "as -1" );
+
+        if (cached) {
+          g[k] = &geoFaceGp(f,0,0);
+        } else {
+          evalGeoFaceGp( f, ndof, coordgp, esuf, inpofa, inpoel, coord,
+                         gpdata.data() + k*ng*stride );
+          g[k] = gpdata.data() + k*ng*stride;
+        }
+
+        for (std::size_t d=0; d<3; ++d) fn[d*W+k] = geoFace(f,d+1,0);
+      }
+      // Pad unused lanes of the last batch with the last face in the batch
+      for (std::size_t k=nf; k<W; ++k)
+        for (std::size_t d=0; d<3; ++d) fn[d*W+k] = fn[d*W+nf-1];
+
+      // compute Riemann fluxes at a quadrature point of all faces in the batch
+      for (std::size_t igp=0; igp<ng; ++igp)
+      {
+        // Gather left and right states and prescribed velocity (if any)
+        for (std::size_t k=0; k<nf; ++k)
+        {
+          const auto f = face[f0+k];
+          std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+          std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+          const auto x = g[k] + igp*stride;
+
+          eval_state( ncomp, offset, ndof, nd(el), el, U, limFunc, x+3,
+                      state.data() );
+          for (std::size_t c=0; c<ncomp; ++c) ul[c*W+k] = state[c];
+
+          eval_state( ncomp, offset, ndof, nd(er), er, U, limFunc, x+3+ndof,
+                      state.data() );
+          for (std::size_t c=0; c<ncomp; ++c) ur[c*W+k] = state[c];
+
+          vel( system, ncomp, x[0], x[1], x[2], vel_gp.data() );
+          for (std::size_t c=0; c<ncomp; ++c)
+            for (std::size_t d=0; d<3; ++d) v[(3*c+d)*W+k] = vel_gp[c][d];
+        }
+        for (std::size_t k=nf; k<W; ++k) {
+          for (std::size_t c=0; c<ncomp; ++c) {
+            ul[c*W+k] = ul[c*W+nf-1];
+            ur[c*W+k] = ur[c*W+nf-1];
+          }
+          for (std::size_t c=0; c<3*ncomp; ++c) v[c*W+k] = v[c*W+nf-1];
+        }
+
+        riemann.fluxFaces( ncomp, fn.data(), ul.data(), ur.data(), v.data(),
+                           fl.data() + igp*ncomp*W );
+      }
+
+      // Gaussian quadrature, in face order so that the rhs is accumulated in
+      // the same order as face by face
+      for (std::size_t k=0; k<nf; ++k)
+      {
+        const auto f = face[f0+k];
+        std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+        std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+
+        const auto wl = fw.empty() ? 1.0 : fw[2*f];
+        const auto wr = fw.empty() ? 1.0 : fw[2*f+1];
+        for (std::size_t igp=0; igp<ng; ++igp)
+        {
+          const auto x = g[k] + igp*stride;
+          auto wt = wgp[igp] * geoFace(f,0,0);
+
+          for (std::size_t c=0; c<ncomp; ++c)
+            flx[c] = fl[(igp*ncomp+c)*W+k];
+
+          // Add the surface integration term to the rhs
+          update_rhs_fa( ncomp, offset, ndof, nd(el), nd(er), wl*wt, wr*wt,
+                         el, er, flx.data(), x+3, x+3+ndof, R );
+        }
+      }
+    }
+  };
+
+  // Keep the faces of a list with a nonzero weight on either side
+  auto active = [&]( const std::vector< std::size_t >& faces ) {
+    std::vector< std::size_t > a;
+    for (auto f : faces)
+      if (std::abs(fw[2*f]) > 0.0 || std::abs(fw[2*f+1]) > 0.0)
+        a.push_back( f );
+    return a;
+  };
+
+  const auto& colors = fd.Colors();
+  if (nthread > 1 && !colors.empty()) {
+    // Integrate the chunks of faces of a color concurrently
+    threadPool( nthread ).run( colors,
+      [&]( const std::vector< std::size_t >& faces ){
+        if (fw.empty()) integrate( faces ); else integrate( active( faces ) );
+      } );
+  } else {
+    // Interior faces to integrate: all of them, or those with nonzero weight
+    std::vector< std::size_t > faces( nfac-nbfac );
+    std::iota( begin(faces), end(faces), nbfac );
+    if (fw.empty()) integrate( faces ); else integrate( active( faces ) );
+  }
+}
 
 } // tk::
 
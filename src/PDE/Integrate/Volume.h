@@ -15,17 +15,69 @@
 #ifndef Volume_h
 #define Volume_h
 
+#include <array>
+#include <algorithm>
+#include <vector>
+
 #include "Basis.h"
 #include "Types.h"
 #include "Fields.h"
 #include "UnsMesh.h"
+#include "Quadrature.h"
+#include "Cache.h"
 #include "FunctionPrototypes.h"
+#include "ThreadPool.h"
+#include "Inciter/InputDeck/InputDeck.h"
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+} // inciter::
 
 namespace tk {
 
 using ncomp_t = kw::ncomp::info::expect::type;
 
+//! Update the rhs by adding the source term integrals
+void
+update_rhs( ncomp_t ncomp,
+            ncomp_t offset,
+            const std::size_t ndof,
+            const std::size_t ndofel,
+            const tk::real wt,
+            const std::size_t e,
+            const tk::real* dBdx,
+            const std::array< tk::real, 3 >* fl,
+            Fields& R );
+
 //! Compute volume integrals for DG
+//! \tparam Flux Physical flux function type following tk::FluxBatchFn
+//! \tparam Vel Prescribed velocity function type following tk::VelBufferFn
+//! \param[in] system Equation system index
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \param[in] offset Offset this PDE system operates from
+//! \param[in] inpoel Element-node connectivity
+//! \param[in] coord Array of nodal coordinates
+//! \param[in] geoElem Element geometry array
+//! \param[in] geoElemGp Element quadrature-point data (if cached, empty if
+//!   not), see tk::genGeoElemGp()
+//! \param[in] flux Flux function to use
+//! \param[in] vel Function to use to query prescribed velocity (if any)
+//! \param[in] U Solution vector at recent time step
+//! \param[in] limFunc Limiter function for higher-order solution dofs
+//! \param[in] ndofel Number of degrees of freedom active on each element. If
+//!   empty, all ndof degrees of freedom are active on all elements.
+//! \param[in] ew Element weights multiplying the volume integrals. If empty,
+//!   all elements are integrated with unit weight, otherwise elements with
+//!   zero weight are skipped.
+//! \param[in,out] R Right-hand side vector added to
+//! \details The flux and velocity functions are template arguments, thus
+//!   they are resolved at compile time. The flux is evaluated for all
+//!   quadrature points of an element at once into work arrays allocated once
+//!   per call, or once per range of elements if multiple threads are
+//!   configured.
+template< class Flux, class Vel >
 void
 volInt( ncomp_t system,
         ncomp_t ncomp,
@@ -33,22 +85,111 @@ volInt( ncomp_t system,
         const std::vector< std::size_t >& inpoel,
         const UnsMesh::Coords& coord,
         const Fields& geoElem,
-        const FluxFn& flux,
-        const VelFn& vel,
+        const Fields& geoElemGp,
+        const Flux& flux,
+        const Vel& vel,
         const Fields& U,
         const Fields& limFunc,
-        Fields& R );
+        const std::vector< std::size_t >& ndofel,
+        const std::vector< real >& ew,
+        Fields& R )
+{
+  const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
 
-//! Update the rhs by adding the source term integrals
-void
-update_rhs( ncomp_t ncomp,
-            ncomp_t offset,
-            const std::size_t ndof,
-            const tk::real wt,
-            const std::size_t e,
-            const std::array< std::vector<tk::real>, 3 >& dBdx,
-            const std::vector< std::array< tk::real, 3 > >& fl,
-            Fields& R );
+  // Number of quadrature points for volume integration
+  auto ng = tk::NGvol(ndof);
+
+  // arrays for quadrature points
+  std::array< std::vector< real >, 3 > coordgp;
+  std::vector< real > wgp;
+
+  coordgp[0].resize( ng );
+  coordgp[1].resize( ng );
+  coordgp[2].resize( ng );
+  wgp.resize( ng );
+
+  // get quadrature point weights and coordinates for tetrahedron
+  GaussQuadratureTet( ng, coordgp, wgp );
+
+  // The basis functions at the quadrature points are the same for all elements
+  // as they are defined on the reference tetrahedron
+  std::vector< real > B( ng*ndof );
+  for (std::size_t igp=0; igp<ng; ++igp) {
+    auto b =
+      eval_basis( ndof, coordgp[0][igp], coordgp[1][igp], coordgp[2][igp] );
+    std::copy( begin(b), end(b), B.begin() + igp*ndof );
+  }
+
+  // Use precomputed quadrature-point data if available
+  const auto cached = geoElemGp.nunk() > 0;
+  const auto stride = gpElemStride( ndof );
+  Assert( !cached || (geoElemGp.nunk() >= U.nunk() &&
+                      geoElemGp.nprop() == ng*stride),
+          "Size mismatch in cached element quadrature-point data" );
+
+  // Compute volume integrals of a range of elements
+  auto integrate = [&]( std::size_t e0, std::size_t e1 )
+  {
+    // Work arrays reused for all elements
+    std::vector< real > gpdata( cached ? 0 : ng*stride );
+    std::vector< real > ugp( ng*ncomp );
+    std::vector< std::array< real, 3 > > v( ng*ncomp, {{ 0.0, 0.0, 0.0 }} );
+    std::vector< std::array< real, 3 > > fl( ng*ncomp );
+
+    for (std::size_t e=e0; e<e1; ++e)
+    {
+      const auto w = ew.empty() ? 1.0 : ew[e];
+      if (!(w > 0.0)) continue;
+
+      // The volume integral of a P0 element is zero
+      const auto nd = ndofel.empty() ? ndof : ndofel[e];
+      if (nd == 1) continue;
+
+      // Quadrature point coordinates and basis function derivatives
+      const real* g = nullptr;
+      if (cached) {
+        g = &geoElemGp(e,0,0);
+      } else {
+        evalGeoElemGp( e, ndof, coordgp, inpoel, coord, gpdata.data() );
+        g = gpdata.data();
+      }
+
+      // Evaluate solution and prescribed velocity (if any) at quadrature
+      // points
+      for (std::size_t igp=0; igp<ng; ++igp)
+      {
+        const auto x = g + igp*stride;
+        eval_state( ncomp, offset, ndof, nd, e, U, limFunc,
+                    B.data() + igp*ndof, ugp.data() + igp*ncomp );
+        vel( system, ncomp, x[0], x[1], x[2], v.data() + igp*ncomp );
+      }
+
+      // compute flux at all quadrature points of the element
+      flux( system, ncomp, ng, ugp.data(), v.data(), fl.data() );
+
+      // Gaussian quadrature
+      for (std::size_t igp=0; igp<ng; ++igp)
+      {
+        auto wt = w * wgp[igp] * geoElem(e, 0, 0);
+        update_rhs( ncomp, offset, ndof, nd, wt, e, g + igp*stride + 3,
+                    fl.data() + igp*ncomp, R );
+      }
+    }
+  };
+
+  // compute volume integrals, with multiple threads in contiguous ranges of
+  // elements if configured: since an element only adds to its own rhs, no
+  // coloring is necessary
+  const auto nelem = U.nunk();
+  const auto nthread = inciter::g_inputdeck.get< tag::discr, tag::nthread >();
+  if (nthread > 1) {
+    const auto nchunk = std::min( 4*nthread, nelem );
+    threadPool( nthread ).run( nchunk, [&]( std::size_t k ){
+      integrate( k*nelem/nchunk, (k+1)*nelem/nchunk ); } );
+  } else {
+    integrate( 0, nelem );
+  }
+}
 
 } // tk::
 
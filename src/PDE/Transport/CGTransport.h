@@ -17,6 +17,7 @@
 #include <array>
 #include <limits>
 #include <cmath>
+#include <algorithm>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -179,14 +180,24 @@ class Transport {
     //! \param[in] deltat Size of time step
     //! \param[in] coord Mesh node coordinates
     //! \param[in] inpoel Mesh element connectivity
+    //! \param[in] geoElem Element Jacobians and shape function gradients, see
+    //!   tk::genGeoElemGrad()
+    //! \param[in] elem Ids of the elements whose contributions to compute
     //! \param[in] U Solution vector at recent time step
     //! \param[in,out] Ue Element-centered solution vector at intermediate step
     //!    (used here internally as a scratch array)
-    //! \param[in,out] R Right-hand side vector computed
+    //! \param[in,out] R Right-hand side vector to add contributions to (not
+    //!   zeroed here, so the caller may pass a subset of the elements)
+    //! \details The element values at the intermediate step only depend on
+    //!   the nodes of the element, so both stages, the gather from the nodes
+    //!   and the scatter of the fluxes to the nodes, are done in a single pass
+    //!   over the elements.
     void rhs( tk::real,
               tk::real deltat,
               const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
+              const tk::Fields& geoElem,
+              const std::vector< std::size_t >& elem,
               const tk::Fields& U,
               tk::Fields& Ue,
               tk::Fields& R ) const
@@ -196,39 +207,38 @@ class Transport {
               "vector at recent time step incorrect" );
       Assert( R.nunk() == coord[0].size(),
               "Number of unknowns in right-hand side vector incorrect" );
+      Assert( geoElem.nunk() == inpoel.size()/4 && geoElem.nprop() == 13,
+              "Element geometry size mismatch" );
 
       const auto& x = coord[0];
       const auto& y = coord[1];
       const auto& z = coord[2];
 
-      // 1st stage: update element values from node values (gather-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      // pointers to solution, element solution, and right hand side at
+      // component and offset, solution at element nodes
+      std::vector< const tk::real* > ue( m_ncomp ), r( m_ncomp );
+      for (ncomp_t c=0; c<m_ncomp; ++c) {
+        ue[c] = Ue.cptr( c, m_offset );
+        r[c] = R.cptr( c, m_offset );
+      }
+      std::vector< std::array< tk::real, 4 > > u( m_ncomp );
+
+      for (auto e : elem) {
 
         // access node IDs
         const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
                                                inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
+        // element Jacobi determinant, J = 6V
+        const auto J = geoElem(e,0,0);
 
         // shape function derivatives, nnode*ndim [4][3]
         std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+        for (std::size_t a=0; a<4; ++a)
+          for (std::size_t j=0; j<3; ++j)
+            grad[a][j] = geoElem(e,1+a*3+j,0);
 
         // access solution at element nodes
-        std::vector< std::array< tk::real, 4 > > u( m_ncomp );
         for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
-        // access solution at elements
-        std::vector< const tk::real* > ue( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue.cptr( c, m_offset );
 
         // sum nodal averages to element
         for (ncomp_t c=0; c<m_ncomp; ++c) {
@@ -255,57 +265,19 @@ class Transport {
             for (std::size_t a=0; a<4; ++a)
               Ue.var(ue[c],e) -= d * grad[a][j] * vel[a][c][j]*u[c][a];
 
-      }
-
-
-      // zero right hand side for all components
-      for (ncomp_t c=0; c<m_ncomp; ++c) R.fill( c, m_offset, 0.0 );
-
-      // 2nd stage: form rhs from element values (scatter-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-
-        // access node IDs
-        const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                               inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
-
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-        // access solution at elements
-        std::vector< tk::real > ue( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) ue[c] = Ue( e, c, m_offset );
-        // access pointer to right hand side at component and offset
-        std::vector< const tk::real* > r( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
-        // access solution at nodes of element
-        std::vector< std::array< tk::real, 4 > > u( m_ncomp );
-        for (ncomp_t c=0; c<m_ncomp; ++c) u[c] = U.extract( c, m_offset, N );
-
-        // get prescribed velocity
+        // get prescribed velocity at element center
         auto xc = (x[N[0]] + x[N[1]] + x[N[2]] + x[N[3]]) / 4.0;
         auto yc = (y[N[0]] + y[N[1]] + y[N[2]] + y[N[3]]) / 4.0;
         auto zc = (z[N[0]] + z[N[1]] + z[N[2]] + z[N[3]]) / 4.0;
-        const auto vel =
+        const auto velc =
           Problem::prescribedVelocity( m_system, m_ncomp, xc, yc, zc );
 
         // scatter-add flux contributions to rhs at nodes
-        tk::real d = deltat * J/6.0;
+        d = deltat * J/6.0;
         for (std::size_t c=0; c<m_ncomp; ++c)
           for (std::size_t j=0; j<3; ++j)
             for (std::size_t a=0; a<4; ++a)
-              R.var(r[c],N[a]) += d * grad[a][j] * vel[c][j]*ue[c];
+              R.var(r[c],N[a]) += d * grad[a][j] * velc[c][j]*Ue.var(ue[c],e);
 
         // add (optional) diffusion contribution to right hand side
         Physics::diffusionRhs( m_system, m_ncomp, deltat, J, grad, N, u, r, R );
@@ -313,6 +285,98 @@ class Transport {
       }
     }
 
+    //! Compute right hand side using edge-based assembly
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoed Edge connectivity, see tk::genInpoed()
+    //! \param[in] edgeCoef Edge coefficients, see tk::genEdgeCoef()
+    //! \param[in] nodeCoef Node coefficients, see tk::genNodeCoef()
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] R Right-hand side vector to add contributions to
+    //! \details The fluxes are interpolated from the nodes, thus they are
+    //!   computed once per node, then assembled in a single pass over the
+    //!   edges, see tk::genEdgeCoef(). The boundary integral of the fluxes is
+    //!   lumped to the nodes using the node coefficients, see
+    //!   tk::genNodeCoef(). The central Galerkin fluxes are stabilized by an
+    //!   edge-based artificial viscosity proportional to the largest
+    //!   advection speed at the two end-points of the edge, see also
+    //!   CompFlow::rhs().
+    void rhs( tk::real,
+              const std::array< std::vector< tk::real >, 3 >& coord,
+              const std::vector< std::size_t >& inpoed,
+              const tk::Fields& edgeCoef,
+              const tk::Fields& nodeCoef,
+              const std::vector< tk::real >&,
+              const tk::Fields& U,
+              tk::Fields& R ) const
+    {
+      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
+              "vector at recent time step incorrect" );
+      Assert( R.nunk() == coord[0].size(),
+              "Number of unknowns in right-hand side vector incorrect" );
+      Assert( edgeCoef.nunk() == inpoed.size()/2 && edgeCoef.nprop() == 10,
+              "Edge coefficients size mismatch" );
+      Assert( nodeCoef.nunk() == coord[0].size() && nodeCoef.nprop() == 3,
+              "Node coefficients size mismatch" );
+
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      const auto npoin = U.nunk();
+
+      // pointers to solution and right hand side at component and offset
+      std::vector< const tk::real* > u( m_ncomp ), r( m_ncomp );
+      for (ncomp_t c=0; c<m_ncomp; ++c) {
+        u[c] = U.cptr( c, m_offset );
+        r[c] = R.cptr( c, m_offset );
+      }
+
+      // compute fluxes at nodes, f[(p*m_ncomp+c)*3+j]: flux of component c in
+      // direction j at node p, and advection speeds at nodes, s[p*m_ncomp+c],
+      // then add own-flux and boundary contributions
+      std::vector< tk::real > f( npoin*m_ncomp*3 ), s( npoin*m_ncomp );
+      for (std::size_t p=0; p<npoin; ++p) {
+        const auto vel =
+          Problem::prescribedVelocity( m_system, m_ncomp, x[p], y[p], z[p] );
+        for (ncomp_t c=0; c<m_ncomp; ++c) {
+          auto fp = f.data() + (p*m_ncomp+c)*3;
+          const auto up = U.var(u[c],p);
+          for (std::size_t j=0; j<3; ++j) fp[j] = vel[c][j]*up;
+          s[p*m_ncomp+c] = std::sqrt( vel[c][0]*vel[c][0] +
+                                      vel[c][1]*vel[c][1] +
+                                      vel[c][2]*vel[c][2] );
+          // own-flux contribution (b_p.F_p) minus the boundary integral
+          // lumped to the node (4 b_p.F_p), see CompFlow::rhs()
+          R.var(r[c],p) -= 3.0 * (nodeCoef(p,0,0)*fp[0] +
+                                  nodeCoef(p,1,0)*fp[1] +
+                                  nodeCoef(p,2,0)*fp[2]);
+        }
+      }
+
+      // scatter-add flux and artificial viscosity contributions to rhs at
+      // edge-end points
+      for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+        const auto p = inpoed[e*2+0];
+        const auto q = inpoed[e*2+1];
+        for (ncomp_t c=0; c<m_ncomp; ++c) {
+          const auto fp = f.data() + (p*m_ncomp+c)*3;
+          const auto fq = f.data() + (q*m_ncomp+c)*3;
+          tk::real rp = 0.0, rq = 0.0;
+          for (std::size_t j=0; j<3; ++j) {
+            rp += edgeCoef(e,j,0) * fq[j];
+            rq += edgeCoef(e,3+j,0) * fp[j];
+          }
+          const auto v = edgeCoef(e,9,0) *
+                         std::max( s[p*m_ncomp+c], s[q*m_ncomp+c] ) *
+                         (U.var(u[c],q) - U.var(u[c],p));
+          R.var(r[c],p) += rp + v;
+          R.var(r[c],q) += rq - v;
+        }
+      }
+
+      // add (optional) diffusion contribution to right hand side
+      Physics::diffusionRhs( m_system, m_ncomp, inpoed, edgeCoef, U, u, r, R );
+    }
+
     //! Compute the minimum time step size
     //! \param[in] U Solution vector at recent time step
     //! \param[in] coord Mesh node coordinates
@@ -118,20 +118,31 @@ class Transport {
     //! \param[in] t Physical time
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
+    //! \param[in] geoFaceGp Face quadrature-point data (empty if not cached)
+    //! \param[in] geoElemGp Element quadrature-point data (empty if not cached)
     //! \param[in] fd Face connectivity and boundary conditions object
     //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] U Solution vector at recent time step
     //! \param[in] limFunc Limiter function for higher-order solution dofs
+    //! \param[in] ndofel Number of degrees of freedom active on each element
+    //!   (empty: all ndof)
+    //! \param[in] fw Face weights for local time stepping (empty: all ones)
+    //! \param[in] ew Element weights for local time stepping (empty: all ones)
     //! \param[in,out] R Right-hand side vector computed
     void rhs( tk::real t,
               const tk::Fields& geoFace,
               const tk::Fields& geoElem,
+              const tk::Fields& geoFaceGp,
+              const tk::Fields& geoElemGp,
               const inciter::FaceData& fd,
               const std::vector< std::size_t >& inpoel,
               const tk::UnsMesh::Coords& coord,
               const tk::Fields& U,
               const tk::Fields& limFunc,
+              const std::vector< std::size_t >& ndofel,
+              const std::vector< tk::real >& fw,
+              const std::vector< tk::real >& ew,
               tk::Fields& R ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
@@ -156,26 +167,33 @@ class Transport {
         { m_bcoutlet, Outlet },
         { m_bcdir, Dirichlet } }};
 
+      // configure prescribed velocity evaluated into caller-provided storage
+      auto velfn = []( ncomp_t system, ncomp_t ncomp, tk::real x, tk::real y,
+                       tk::real z, std::array< tk::real, 3 >* v ) {
+        auto vel = Problem::prescribedVelocity( system, ncomp, x, y, z );
+        std::copy( begin(vel), end(vel), v ); };
+
       // compute internal surface flux integrals
       tk::surfInt( m_system, m_ncomp, m_offset, inpoel, coord, fd, geoFace,
-                   Upwind::flux, Problem::prescribedVelocity, U, limFunc, R );
+                   geoFaceGp, Upwind(), velfn, U, limFunc, ndofel, fw, R );
 
       if(ndof > 1)
         // compute volume integrals
         tk::volInt( m_system, m_ncomp, m_offset, inpoel, coord, geoElem,
-                    flux, Problem::prescribedVelocity, U, limFunc, R );
+                    geoElemGp, flux, velfn, U, limFunc, ndofel, ew, R );
 
       // compute boundary surface flux integrals
       for (const auto& b : bctypes)
         tk::bndSurfInt( m_system, m_ncomp, m_offset, b.first, fd, geoFace,
-          inpoel, coord, t, Upwind::flux, Problem::prescribedVelocity,
-          b.second, U, limFunc, R );
+          geoFaceGp, inpoel, coord, t, Upwind(), velfn, b.second, U, limFunc,
+          ndofel, fw, R );
     }
 
     //! Compute the minimum time step size
 //     //! \param[in] U Solution vector at recent time step
 //     //! \param[in] coord Mesh node coordinates
 //     //! \param[in] inpoel Mesh element connectivity
+    //! \param[out] dte Stable time step size of each element
     //! \return Minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& /*coord*/,
                  const std::vector< std::size_t >& /*inpoel*/,
@@ -183,9 +201,11 @@ class Transport {
                  const tk::Fields& /*geoFace*/,
                  const tk::Fields& /*geoElem*/,
                  const tk::Fields& /*limFunc*/,
-                 const tk::Fields& /*U*/ ) const
+                 const tk::Fields& U,
+                 std::vector< tk::real >& dte ) const
     {
       tk::real mindt = std::numeric_limits< tk::real >::max();
+      dte.assign( U.nunk(), mindt );
       return mindt;
     }
 
@@ -307,27 +327,24 @@ class Transport {
 
     //! Evaluate physical flux function for this PDE system
     //! \param[in] ncomp Number of scalar components in this PDE system
-    //! \param[in] ugp Numerical solution at the Gauss point at which to
-    //!   evaluate the flux
-    //! \param[in] v Prescribed velocity evaluated at the Gauss point at which
-    //!   to evaluate the flux
-    //! \return Flux vectors for all components in this PDE system
-    //! \note The function signature must follow tk::FluxFn
-    static tk::FluxFn::result_type
+    //! \param[in] ng Number of points at which to evaluate the flux
+    //! \param[in] ugp Numerical solution at the points at which to evaluate
+    //!   the flux, ng x ncomp
+    //! \param[in] v Prescribed velocity evaluated at the points at which to
+    //!   evaluate the flux, ng x ncomp
+    //! \param[in,out] fl Flux vectors for all components in this PDE system at
+    //!   all points, ng x ncomp
+    //! \note The function signature must follow tk::FluxBatchFn
+    static void
     flux( ncomp_t,
           ncomp_t ncomp,
-          const std::vector< tk::real >& ugp,
-          const std::vector< std::array< tk::real, 3 > >& v )
+          std::size_t ng,
+          const tk::real* ugp,
+          const std::array< tk::real, 3 >* v,
+          std::array< tk::real, 3 >* fl )
     {
-      Assert( ugp.size() == ncomp, "Size mismatch" );
-      Assert( v.size() == ncomp, "Size mismatch" );
-
-      std::vector< std::array< tk::real, 3 > > fl( ugp.size() );
-
-      for (ncomp_t c=0; c<ncomp; ++c)
-        fl[c] = {{ v[c][0] * ugp[c], v[c][1] * ugp[c], v[c][2] * ugp[c] }};
-
-      return fl;
+      for (std::size_t i=0; i<ng*ncomp; ++i)
+        fl[i] = {{ v[i][0] * ugp[i], v[i][1] * ugp[i], v[i][2] * ugp[i] }};
     }
 
     //! \brief Boundary state function providing the left and right state of a
@@ -24,7 +24,8 @@
       class, collecting all possible options for Physics policies.
 
     - Must define the static function _diffusionRhs()_, adding diffusion terms
-      to the right hand side.
+      to the right hand side, in two overloads: one for the element-based and
+      one for the edge-based assembly.
 
     - Must define the static function _diffusion_dt()_, computing the minumum
       time step size based on the diffusion term.
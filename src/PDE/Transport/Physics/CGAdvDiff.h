@@ -68,6 +68,43 @@ class TransportPhysicsAdvDiff {
         }
     }
 
+    //! Add diffusion contribution to rhs using edge-based assembly
+    //! \param[in] e Equation system index, i.e., which transport equation
+    //!   system we operate on among the systems of PDEs
+    //! \param[in] ncomp Number of components in this PDE
+    //! \param[in] inpoed Edge connectivity, see tk::genInpoed()
+    //! \param[in] edgeCoef Edge coefficients, see tk::genEdgeCoef()
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in] u Pointers to solution at component and offset
+    //! \param[in] r Pointers to right hand side at component and offset
+    //! \param[in,out] R Right-hand side vector contributing to
+    static void
+    diffusionRhs( tk::ctr::ncomp_type e,
+                  tk::ctr::ncomp_type ncomp,
+                  const std::vector< std::size_t >& inpoed,
+                  const tk::Fields& edgeCoef,
+                  const tk::Fields& U,
+                  const std::vector< const tk::real* >& u,
+                  const std::vector< const tk::real* >& r,
+                  tk::Fields& R )
+    {
+      // diffusivities for all components
+      const auto& diff =
+        g_inputdeck.get< tag::param, tag::transport, tag::diffusivity >().at(e);
+      // add diffusion contribution to right hand side
+      for (std::size_t l=0; l<inpoed.size()/2; ++l) {
+        const auto p = inpoed[l*2+0];
+        const auto q = inpoed[l*2+1];
+        for (tk::ctr::ncomp_type c=0; c<ncomp; ++c) {
+          tk::real k = 0.0;
+          for (std::size_t j=0; j<3; ++j) k += diff[3*c+j] * edgeCoef(l,6+j,0);
+          const auto d = k * (U.var(u[c],q) - U.var(u[c],p));
+          R.var(r[c],p) -= d;
+          R.var(r[c],q) += d;
+        }
+      }
+    }
+
     //! Compute the minimum time step size based on the diffusion
     //! \param[in] e Equation system index, i.e., which transport equation
     //!   system we operate on among the systems of PDEs
@@ -44,6 +44,18 @@ class TransportPhysicsAdvection {
                   tk::Fields& )
     {}
 
+    //! Add diffusion contribution to rhs using edge-based assembly (no-op)
+    static void
+    diffusionRhs( tk::ctr::ncomp_type,
+                  tk::ctr::ncomp_type,
+                  const std::vector< std::size_t >&,
+                  const tk::Fields&,
+                  const tk::Fields&,
+                  const std::vector< const tk::real* >&,
+                  const std::vector< const tk::real* >&,
+                  tk::Fields& )
+    {}
+
     //! Compute the minimum time step size based on the diffusion
     //! \return A large time step size, i.e., ignore
     static tk::real
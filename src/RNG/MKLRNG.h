@@ -12,6 +12,8 @@
 #ifndef MKLRNG_h
 #define MKLRNG_h
 
+#include <vector>
+
 #include <mkl_vsl.h>
 
 #include "Exception.h"
@@ -234,6 +236,28 @@ class MKLRNG {
     std::size_t nthreads() const noexcept
     { return static_cast< std::size_t >( m_nthreads); }
 
+    //! Query the state of a stream
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \return The stream saved to memory by MKL VSL
+    std::vector< char > state( int tid ) const {
+      const auto& str = m_stream[ static_cast<std::size_t>(tid) ];
+      std::vector< char > s( static_cast< std::size_t >(
+                               vslGetStreamSize( str ) ) );
+      errchk( vslSaveStreamM( str, s.data() ) );
+      return s;
+    }
+
+    //! Set the state of a stream
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \param[in] s The stream saved to memory by MKL VSL, see state( int )
+    void state( int tid, const std::vector< char >& s ) const {
+      auto& str = m_stream[ static_cast<std::size_t>(tid) ];
+      VSLStreamStatePtr loaded;
+      errchk( vslLoadStreamM( &loaded, s.data() ) );
+      if (str) vslDeleteStream( &str );
+      str = loaded;
+    }
+
   private:
     //! Delete all thread streams
     void deleteStreams() {
@@ -251,7 +275,7 @@ class MKLRNG {
     //! \details This calls ErrChk(), i.e., it is not compiled away in Release
     //!   mode as an error here can result due to user input incompatible with
     //!   the MKL library.
-    void errchk( int err ) {
+    void errchk( int err ) const {
       ErrChk( err == VSL_STATUS_OK, "MKL VSL Error Code: " +
               std::to_string(err) + ", see mkl_vsl_defines.h for more info" );
     }
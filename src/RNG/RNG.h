@@ -17,6 +17,7 @@
 #ifndef RNG_h
 #define RNG_h
 
+#include <vector>
 #include <functional>
 
 #include "Make_unique.h"
@@ -81,6 +82,14 @@ class RNG {
     //! Public interface to number of threads accessor
     std::size_t nthreads() const noexcept { return self->nthreads(); }
 
+    //! Public interface to querying the state of a stream
+    std::vector< char > state( int stream ) const
+    { return self->state( stream ); }
+
+    //! Public interface to setting the state of a stream
+    void state( int stream, const std::vector< char >& s ) const
+    { self->state( stream, s ); }
+
     //! Copy assignment
     RNG& operator=( const RNG& x )
     { RNG tmp(x); *this = std::move(tmp); return *this; }
@@ -107,6 +116,8 @@ class RNG {
         const = 0;
       virtual void gamma( int, ncomp_t, double, double, double* ) const = 0;
       virtual std::size_t nthreads() const noexcept = 0;
+      virtual std::vector< char > state( int ) const = 0;
+      virtual void state( int, const std::vector< char >& ) const = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -129,6 +140,10 @@ class RNG {
       void gamma( int stream, ncomp_t num, double a, double b, double* r ) const
         override { data.gamma( stream, num, a, b, r ); }
       std::size_t nthreads() const noexcept override { return data.nthreads(); }
+      std::vector< char > state( int stream ) const override
+      { return data.state( stream ); }
+      void state( int stream, const std::vector< char >& s ) const override
+      { data.state( stream, s ); }
       T data;
     };
 
@@ -14,6 +14,7 @@
 
 #include <cstring>
 #include <random>
+#include <vector>
 
 #include "NoWarning/beta_distribution.h"
 #include <boost/random/gamma_distribution.hpp>
@@ -206,6 +207,24 @@ class RNGSSE {
     //! Accessor to the number of threads we operate on
     SeqNumType nthreads() const noexcept { return m_nthreads; }
 
+    //! Query the state of a stream
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \return The state of the stream as raw bytes
+    std::vector< char > state( int tid ) const {
+      const auto& str = m_stream[ static_cast<std::size_t>(tid) ];
+      const auto b = reinterpret_cast< const char* >( &str );
+      return std::vector< char >( b, b + sizeof(State) );
+    }
+
+    //! Set the state of a stream
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \param[in] s The state of the stream as raw bytes, see state( int )
+    void state( int tid, const std::vector< char >& s ) const {
+      Assert( s.size() == sizeof(State), "RNGSSE stream state size mismatch" );
+      std::memcpy( &m_stream[ static_cast<std::size_t>(tid) ], s.data(),
+                   sizeof(State) );
+    }
+
   private:
     SeqNumType m_nthreads;                 //!< Number of threads
     InitFn m_init;                         //!< Sequence length initializer
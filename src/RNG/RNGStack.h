@@ -44,7 +44,8 @@ class RNGStack {
                        #ifdef HAS_RNGSSE2
                        const ctr::RNGSSEParameters& rngsseparam,
                        #endif
-                       const ctr::RNGRandom123Parameters& r123param );
+                       const ctr::RNGRandom123Parameters& r123param,
+                       bool r123bulk = false );
 
     //! Instantiate selected RNGs
     std::map< std::underlying_type< tk::ctr::RNGType >::type, tk::RNG >
@@ -65,7 +66,9 @@ class RNGStack {
    #endif
 
    //! Register Random123 RNGs into factory
-   void regRandom123( int nstream, const ctr::RNGRandom123Parameters& param );
+   void regRandom123( int nstream,
+                      const ctr::RNGRandom123Parameters& param,
+                      bool bulk );
 
    RNGFactory m_factory;        //!< Random nunmber generator factory
 };
@@ -6,7 +6,19 @@
              2019 Triad National Security, LLC.
              All rights reserved. See the LICENSE file for details.
   \brief     Interface to Random123 random number generators
-  \details   Interface to Random123 random number generators
+  \details   Interface to Random123 random number generators. Random123
+    generators are counter-based: each call to the generator maps a counter
+    and a key to a block of random words, independently of all other
+    counters. By default, only the first word of each block is used, and
+    Gaussian, beta, and gamma random numbers are transformed from such uniform
+    words, one at a time, by the standard library and boost::random. In bulk
+    mode, uniform and Gaussian random numbers are instead generated from all
+    words of a batch of consecutive blocks, whose ciphers are independent of
+    each other and thus vectorize, and Gaussian random numbers are transformed
+    from the uniform ones in batches using the Box-Muller transform. The
+    numbers generated depend only on the seed, the stream, and the sequence
+    of the numbers requested, in both modes, but the streams of the two modes
+    differ.
 */
 // *****************************************************************************
 #ifndef Random123_h
@@ -14,8 +26,11 @@
 
 #include <cstring>
 #include <random>
+#include <vector>
 #include <limits>
 #include <array>
+#include <cmath>
+#include <algorithm>
 
 #include "NoWarning/uniform.h"
 #include "NoWarning/beta_distribution.h"
@@ -34,11 +49,15 @@ class Random123 {
 
   private:
     static const std::size_t CBRNG_DATA_SIZE = 3;
+    //! Number of blocks generated at a time in bulk mode
+    static const std::size_t BATCH = 64;
     using ncomp_t = kw::ncomp::info::expect::type;    
     using ctr_type = typename CBRNG::ctr_type;
     using key_type = typename CBRNG::key_type;
     using value_type = typename CBRNG::ctr_type::value_type;
     using arg_type = std::vector< std::array< value_type, CBRNG_DATA_SIZE > >;
+    //! Number of random words in a block
+    static const std::size_t NWORD = sizeof(ctr_type) / sizeof(value_type);
 
     //! Adaptor to use a std distribution with the Random123 generator
     //! \see C++ concepts: UniformRandomNumberGenerator
@@ -70,7 +89,11 @@ class Random123 {
     //! Constructor
     //! \param[in] n Initialize RNG using this many independent streams
     //! \param[in] seed RNG seed
-    explicit Random123( uint64_t n = 1, uint64_t seed = 0 ) {
+    //! \param[in] bulk True to generate uniform and Gaussian random numbers
+    //!   in bulk mode, see uniformBulk() and gaussianBulk()
+    explicit Random123( uint64_t n = 1, uint64_t seed = 0, bool bulk = false )
+      : m_bulk( bulk )
+    {
       Assert( n > 0, "Need at least one thread" );
       m_data.resize( n, {{ 0, seed << 32, 0 }} );
     }
@@ -80,6 +103,7 @@ class Random123 {
     //! \param[in] num Number of RNGs to generate
     //! \param[in,out] r Pointer to memory to write the random numbers to
     void uniform( int tid, ncomp_t num, double* r ) const {
+      if (m_bulk) { uniformBulk( tid, num, r ); return; }
       auto& d = m_data[ static_cast< std::size_t >( tid ) ];
       for (ncomp_t i=0; i<num; ++i) {
         d[2] = static_cast< unsigned long >( tid );
@@ -111,6 +135,7 @@ class Random123 {
     //!   cache, as Box-Muller, implemented using the polar algorithm generates
     //!   2 Gaussian numbers for each pair of uniform ones, caching every 2nd.
     void gaussian( int tid, ncomp_t num, double* r ) const {
+      if (m_bulk) { gaussianBulk( tid, num, r ); return; }
       Adaptor generator( m_rng, m_data, tid );
       std::normal_distribution<> gauss_dist( 0.0, 1.0 );
       for (ncomp_t i=0; i<num; ++i) r[i] = gauss_dist( generator );
@@ -180,12 +205,112 @@ class Random123 {
       for (ncomp_t i=0; i<num; ++i) r[i] = gamma_dist( generator );
     }
 
+    //! Uniform RNG: Generate uniform random numbers from full blocks
+    //! \param[in] tid Thread (or more precisely) stream ID
+    //! \param[in] num Number of RNGs to generate
+    //! \param[in,out] r Pointer to memory to write the random numbers to
+    //! \details All words of the blocks are used. If num is not a multiple of
+    //!   the number of words in a block, the remaining words of the last
+    //!   block are discarded.
+    void uniformBulk( int tid, ncomp_t num, double* r ) const {
+      std::array< value_type, BATCH*NWORD > w;
+      for (ncomp_t i=0; i<num; i+=BATCH*NWORD) {
+        const auto n = std::min( BATCH*NWORD, num-i );
+        blocks( tid, (n+NWORD-1)/NWORD, w.data() );
+        for (std::size_t j=0; j<n; ++j)
+          r[i+j] = r123::u01fixedpt< double, value_type >( w[j] );
+      }
+    }
+
+    //! Gaussian RNG: Generate Gaussian random numbers from full blocks
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \param[in] num Number of RNGs to generate
+    //! \param[in,out] r Pointer to memory to write the random numbers to
+    //! \details Pairs of uniform random numbers, from the open interval
+    //!   (0,1), are transformed to pairs of independent Gaussian ones using
+    //!   the basic (trigonometric) form of the Box-Muller transform, which,
+    //!   unlike the polar form, needs no rejection and thus no branches. If
+    //!   num is odd, the second number of the last pair is discarded.
+    void gaussianBulk( int tid, ncomp_t num, double* r ) const {
+      static const std::size_t N = BATCH*NWORD;
+      std::array< value_type, N > w;
+      std::array< double, N > z;
+      const double twopi = 2.0 * M_PI;
+      for (ncomp_t i=0; i<num; i+=N) {
+        const auto n = std::min( N, num-i );
+        const auto npair = (n+1)/2;
+        blocks( tid, (2*npair+NWORD-1)/NWORD, w.data() );
+        for (std::size_t j=0; j<npair; ++j) {
+          const auto u1 = r123::u01fixedpt< double, value_type >( w[2*j] );
+          const auto u2 = r123::u01fixedpt< double, value_type >( w[2*j+1] );
+          const auto rad = std::sqrt( -2.0 * std::log( u1 ) );
+          z[2*j] = rad * std::cos( twopi * u2 );
+          z[2*j+1] = rad * std::sin( twopi * u2 );
+        }
+        std::copy( z.data(), z.data() + n, r + i );
+      }
+    }
+
     //! Accessor to the number of threads we operate on
     uint64_t nthreads() const noexcept { return m_data.size(); }
 
+    //! Query the state of a stream
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \return The counter and key of the stream as raw bytes
+    std::vector< char > state( int tid ) const {
+      const auto& d = m_data[ static_cast< std::size_t >( tid ) ];
+      const auto b = reinterpret_cast< const char* >( d.data() );
+      return std::vector< char >( b, b + sizeof(d) );
+    }
+
+    //! Set the state of a stream
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \param[in] s The counter and key of the stream as raw bytes, see
+    //!   state( int )
+    void state( int tid, const std::vector< char >& s ) const {
+      auto& d = m_data[ static_cast< std::size_t >( tid ) ];
+      Assert( s.size() == sizeof(d), "Random123 stream state size mismatch" );
+      std::memcpy( d.data(), s.data(), sizeof(d) );
+    }
+
   private:
     mutable CBRNG m_rng;        //!< Random123 RNG object
     mutable arg_type m_data;    //!< RNG arguments
+    bool m_bulk;                //!< True if uniform and Gaussian in bulk mode
+
+    //! Generate consecutive blocks of random words
+    //! \param[in] tid Thread (or more precisely stream) ID
+    //! \param[in] nblock Number of blocks to generate
+    //! \param[in,out] w Pointer to memory to write nblock*NWORD words to
+    //! \details The counter of each block is computed from the first one
+    //!   without a dependence on the previous block, so the ciphers of the
+    //!   blocks are independent of each other and vectorize, unless the low
+    //!   word of the counter would wrap around, in which case the counter is
+    //!   incremented block by block.
+    void blocks( int tid, std::size_t nblock, value_type* w ) const {
+      auto& d = m_data[ static_cast< std::size_t >( tid ) ];
+      d[2] = static_cast< value_type >( tid );
+      const key_type key = {{ d[2] }};
+      ctr_type ctr = {{ d[0], d[1] }};
+      if (ctr[0] <= std::numeric_limits< value_type >::max() - nblock) {
+        const auto c0 = ctr[0];
+        for (std::size_t b=0; b<nblock; ++b) {
+          ctr_type c = ctr;
+          c[0] = c0 + b;
+          const auto res = m_rng( c, key );
+          for (std::size_t k=0; k<NWORD; ++k) w[b*NWORD+k] = res[k];
+        }
+        ctr[0] = c0 + nblock;
+      } else {
+        for (std::size_t b=0; b<nblock; ++b) {
+          const auto res = m_rng( ctr, key );
+          for (std::size_t k=0; k<NWORD; ++k) w[b*NWORD+k] = res[k];
+          ctr.incr();
+        }
+      }
+      d[0] = ctr[0];
+      d[1] = ctr[1];
+    }
 };
 
 } // tk::
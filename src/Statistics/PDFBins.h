@@ -0,0 +1,378 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/PDFBins.h
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Bins of PDF estimators
+  \details   Bins of PDF estimators. This class stores the sample counters of
+    the bins of a univariate, bivariate, or trivariate PDF estimator, see
+    UniPDF, BiPDF, and TriPDF. The bins are stored in a dense array covering a
+    box of bin ids in sample space, which grows on demand, geometrically, as
+    samples outside of the box are added, thus adding a sample costs a bounds
+    check and an increment. Only if the box would exceed a memory budget are
+    the bins stored in a hash-based associative container, std::unordered_map,
+    instead. The minimum and maximum bin ids of the samples added are tracked
+    as samples are added, and only the bins between these extents are
+    serialized, yielding a compact binary format for merging PDFs across PEs,
+    see PDFReducer.
+*/
+// *****************************************************************************
+#ifndef PDFBins_h
+#define PDFBins_h
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include "Types.h"
+#include "PUPUtil.h"
+
+namespace tk {
+
+//! \brief Number of samples whose bin ids are computed at a time when adding
+//!   multiple samples to a PDF
+static const std::size_t PDFBatch = 64;
+
+//! Bins of PDF estimators
+//! \tparam dim Number of sample space dimensions
+template< std::size_t dim >
+class PDFBins {
+
+  public:
+    //! Key type: bin ids in all sample space dimensions
+    using key_type = std::array< long, dim >;
+
+    //! Hash functor for key_type
+    struct key_hash {
+      std::size_t operator()( const key_type& key ) const {
+        std::size_t h = 0;
+        for (auto k : key) h ^= std::hash< long >()( k );
+        return h;
+      }
+    };
+
+    //! Sparse bins: key is the bin ids, mapped value is the sample counter
+    using map_type = std::unordered_map< key_type, tk::real, key_hash >;
+
+    //! \brief Maximum number of dense bins, beyond which bins are stored
+    //!   sparse, i.e., 8 MiB of sample counters
+    static const std::size_t budget = 1UL << 20;
+
+    //! Constructor
+    explicit PDFBins() :
+      m_sparse( false ),
+      m_lo(),
+      m_ext(),
+      m_min(),
+      m_max(),
+      m_dense(),
+      m_map()
+    {
+      m_lo.fill( 0 );
+      m_ext.fill( 0 );
+      reset();
+    }
+
+    //! Query if no samples have been added
+    //! \return True if no samples have been added
+    bool empty() const noexcept { return m_min[0] > m_max[0]; }
+
+    //! Query if bins are stored sparse
+    //! \return True if bins are stored in a hash-based associative container
+    bool sparse() const noexcept { return m_sparse; }
+
+    //! Add to sample counter of a bin
+    //! \param[in] k Bin ids
+    //! \param[in] c Number of samples to add
+    void add( const key_type& k, tk::real c = 1.0 ) {
+      for (std::size_t d=0; d<dim; ++d) {
+        m_min[d] = std::min( m_min[d], k[d] );
+        m_max[d] = std::max( m_max[d], k[d] );
+      }
+      if (!m_sparse) {
+        if (!inside( k )) cover( k );
+        if (!m_sparse) {
+          m_dense[ index( k ) ] += c;
+          return;
+        }
+      }
+      m_map[ k ] += c;
+    }
+
+    //! Add bins of other PDF bins
+    //! \param[in] b Bins whose samples to add
+    void merge( const PDFBins& b ) {
+      if (b.empty()) return;
+      // Grow box once to cover the extents of the bins to add
+      if (!m_sparse) {
+        cover( b.m_min );
+        cover( b.m_max );
+      }
+      b.each( [this]( const key_type& k, tk::real c ){ add( k, c ); } );
+    }
+
+    //! Zero bins
+    //! \details Dense bins keep their box, so the box does not have to grow
+    //!   again when the next samples are added, e.g., in the next time step.
+    void zero() {
+      if (m_sparse) {
+        m_sparse = false;
+        m_map.clear();
+        m_lo.fill( 0 );
+        m_ext.fill( 0 );
+        m_dense.clear();
+      } else {
+        std::fill( begin(m_dense), end(m_dense), 0.0 );
+      }
+      reset();
+    }
+
+    //! Call function for all nonempty bins
+    //! \param[in] f Function to call with the bin ids and the sample counter
+    template< class F >
+    void each( F&& f ) const {
+      if (empty()) return;
+      if (m_sparse) {
+        for (const auto& b : m_map) f( b.first, b.second );
+      } else {
+        key_type ext;
+        std::size_t n = 1;
+        for (std::size_t d=0; d<dim; ++d) {
+          ext[d] = m_max[d] - m_min[d] + 1;
+          n *= static_cast< std::size_t >( ext[d] );
+        }
+        key_type k;
+        for (std::size_t i=0; i<n; ++i) {
+          auto j = i;
+          for (std::size_t d=dim; d-- > 0; ) {
+            const auto e = static_cast< std::size_t >( ext[d] );
+            k[d] = m_min[d] + static_cast< long >( j % e );
+            j /= e;
+          }
+          const auto c = m_dense[ index( k ) ];
+          if (c > 0.0) f( k, c );
+        }
+      }
+    }
+
+    //! Return minimum and maximum bin ids of sample space
+    //! \return {xmin,xmax,ymin,ymax,...} Minima and maxima of the bin ids in
+    //!   all sample space dimensions
+    std::array< long, 2*dim > extents() const noexcept {
+      std::array< long, 2*dim > e;
+      for (std::size_t d=0; d<dim; ++d) {
+        e[2*d] = m_min[d];
+        e[2*d+1] = m_max[d];
+      }
+      return e;
+    }
+
+    /** @name Pack/Unpack: Serialize PDFBins object for Charm++ */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \details Dense bins are serialized only between the extents of the
+    //!   samples added, and are unpacked into a box of exactly that size.
+    void pup( PUP::er& p ) {
+      p | m_sparse;
+      p | m_min;
+      p | m_max;
+      if (m_sparse) {
+        p | m_map;
+      } else if (p.isUnpacking()) {
+        if (empty()) {
+          m_lo.fill( 0 );
+          m_ext.fill( 0 );
+          m_dense.clear();
+        } else {
+          m_lo = m_min;
+          for (std::size_t d=0; d<dim; ++d)
+            m_ext[d] = static_cast< std::size_t >( m_max[d] - m_min[d] + 1 );
+          m_dense.resize( size( m_ext ) );
+          p( m_dense.data(), m_dense.size() );
+        }
+      } else if (!empty()) {
+        std::vector< tk::real > box;
+        each_in_extents( [&box]( tk::real c ){ box.push_back( c ); } );
+        p( box.data(), box.size() );
+      }
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] b PDFBins object reference
+    friend void operator|( PUP::er& p, PDFBins& b ) { b.pup(p); }
+    ///@}
+
+  private:
+    bool m_sparse;                      //!< True if bins are stored sparse
+    key_type m_lo;                      //!< Smallest bin ids of dense box
+    std::array< std::size_t, dim > m_ext;       //!< Extents of dense box
+    key_type m_min;                     //!< Smallest bin ids of samples
+    key_type m_max;                     //!< Largest bin ids of samples
+    std::vector< tk::real > m_dense;    //!< Dense bins, last dim fastest
+    map_type m_map;                     //!< Sparse bins
+
+    //! Reset extents of samples to empty
+    void reset() {
+      m_min.fill( std::numeric_limits< long >::max() );
+      m_max.fill( std::numeric_limits< long >::lowest() );
+    }
+
+    //! Compute number of bins in a box
+    //! \param[in] ext Extents of box
+    //! \return Number of bins in box
+    static std::size_t size( const std::array< std::size_t, dim >& ext ) {
+      std::size_t n = 1;
+      for (auto e : ext) n *= e;
+      return n;
+    }
+
+    //! Query if bin is inside the dense box
+    //! \param[in] k Bin ids
+    //! \return True if bin is inside the dense box
+    bool inside( const key_type& k ) const noexcept {
+      for (std::size_t d=0; d<dim; ++d)
+        if (offset( k[d], m_lo[d] ) >= m_ext[d]) return false;
+      return true;
+    }
+
+    //! Compute index of bin in dense box
+    //! \param[in] k Bin ids, must be inside the dense box
+    //! \return Index of bin in dense bins
+    std::size_t index( const key_type& k ) const noexcept {
+      std::size_t i = 0;
+      for (std::size_t d=0; d<dim; ++d)
+        i = i * m_ext[d] + offset( k[d], m_lo[d] );
+      return i;
+    }
+
+    //! Compute offset of bin id from another, without signed overflow
+    //! \param[in] k Bin id
+    //! \param[in] lo Bin id to compute offset from
+    //! \return Offset of k from lo, wrapped around if k < lo
+    static std::size_t offset( long k, long lo ) noexcept {
+      return static_cast< std::size_t >( k ) - static_cast< std::size_t >( lo );
+    }
+
+    //! Call function for all dense bins between the extents of the samples
+    //! \param[in] f Function to call with the sample counter
+    template< class F >
+    void each_in_extents( F&& f ) const {
+      std::array< std::size_t, dim > ext;
+      for (std::size_t d=0; d<dim; ++d)
+        ext[d] = static_cast< std::size_t >( m_max[d] - m_min[d] + 1 );
+      const auto n = size( ext );
+      key_type k;
+      for (std::size_t i=0; i<n; ++i) {
+        auto j = i;
+        for (std::size_t d=dim; d-- > 0; ) {
+          k[d] = m_min[d] + static_cast< long >( j % ext[d] );
+          j /= ext[d];
+        }
+        f( m_dense[ index( k ) ] );
+      }
+    }
+
+    //! Grow dense box to cover a bin or switch to sparse bins
+    //! \param[in] k Bin ids to cover
+    //! \details The box is grown by half of its new extent in the directions
+    //!   it grows in, so that growing is amortized when, e.g., the PDF drifts
+    //!   or widens over time. If the box would exceed the memory budget even
+    //!   without this slack, the bins are moved to a sparse container.
+    void cover( const key_type& k ) {
+      if (inside( k )) return;
+      const bool first = m_dense.empty();
+      key_type lo, slo;
+      std::array< std::size_t, dim > ext, sext;
+      for (std::size_t d=0; d<dim; ++d) {
+        // New box, covering the old box and k
+        long hi;
+        if (first) {
+          lo[d] = hi = k[d];
+        } else {
+          lo[d] = std::min( m_lo[d], k[d] );
+          hi = std::max( m_lo[d] + static_cast< long >( m_ext[d] - 1 ), k[d] );
+        }
+        // Exceeding the budget in a single dimension also guards against
+        // overflow below, e.g., due to bin ids of non-finite samples
+        if (offset( hi, lo[d] ) >= budget) { tosparse(); return; }
+        ext[d] = offset( hi, lo[d] ) + 1;
+        // Add slack in the directions the box grows in
+        const auto w = static_cast< long >( ext[d] / 2 );
+        const auto below = first || k[d] < m_lo[d];
+        const auto above =
+          first || (k[d] >= m_lo[d] && offset( k[d], m_lo[d] ) >= m_ext[d]);
+        slo[d] = lo[d];
+        sext[d] = ext[d];
+        if (below && lo[d] > std::numeric_limits< long >::lowest() + w) {
+          slo[d] -= w;
+          sext[d] += static_cast< std::size_t >( w );
+        }
+        if (above && hi < std::numeric_limits< long >::max() - w)
+          sext[d] += static_cast< std::size_t >( w );
+      }
+      if (size( sext ) <= budget) {
+        regrid( slo, sext );
+      } else if (size( ext ) <= budget) {
+        regrid( lo, ext );
+      } else {
+        tosparse();
+      }
+    }
+
+    //! Copy dense bins into a new box
+    //! \param[in] lo Smallest bin ids of new box
+    //! \param[in] ext Extents of new box, must contain the old box
+    void regrid( const key_type& lo, const std::array< std::size_t, dim >& ext )
+    {
+      std::vector< tk::real > dense( size( ext ), 0.0 );
+      const auto n = m_dense.size();
+      key_type k;
+      for (std::size_t i=0; i<n; ++i) {
+        if (m_dense[i] > 0.0) {
+          auto j = i;
+          for (std::size_t d=dim; d-- > 0; ) {
+            k[d] = m_lo[d] + static_cast< long >( j % m_ext[d] );
+            j /= m_ext[d];
+          }
+          std::size_t l = 0;
+          for (std::size_t d=0; d<dim; ++d)
+            l = l * ext[d] + static_cast< std::size_t >( k[d] - lo[d] );
+          dense[l] = m_dense[i];
+        }
+      }
+      m_lo = lo;
+      m_ext = ext;
+      m_dense = std::move( dense );
+    }
+
+    //! Move dense bins to sparse container
+    void tosparse() {
+      const auto n = m_dense.size();
+      key_type k;
+      for (std::size_t i=0; i<n; ++i) {
+        if (m_dense[i] > 0.0) {
+          auto j = i;
+          for (std::size_t d=dim; d-- > 0; ) {
+            k[d] = m_lo[d] + static_cast< long >( j % m_ext[d] );
+            j /= m_ext[d];
+          }
+          m_map[ k ] += m_dense[i];
+        }
+      }
+      m_sparse = true;
+      m_lo.fill( 0 );
+      m_ext.fill( 0 );
+      m_dense.clear();
+      m_dense.shrink_to_fit();
+    }
+};
+
+} // tk::
+
+#endif // PDFBins_h
@@ -99,12 +99,30 @@ class Statistics {
     //! Accumulate (i.e., only do the sum for) central PDFs
     void accumulateCenPDF( const std::vector< tk::real >& om );
 
+    //! Prepare for accumulating statistics a chunk of particles at a time
+    void zeroFused( const std::vector< tk::real >& shift, bool pdf );
+
+    //! \brief Accumulate (i.e., only do the sum for) ordinary moments, shifted
+    //!   central moments, and optionally ordinary PDFs for a chunk of particles
+    void accumulateFused( std::size_t from, std::size_t till, bool pdf );
+
+    //! Estimate central moments from shifted central moments
+    static std::vector< tk::real >
+    fromShifted( const std::vector< ctr::Product >& stat,
+                 const std::vector< tk::real >& om,
+                 const std::vector< tk::real >& shift,
+                 const std::vector< tk::real >& sm );
+
     //! Ordinary moments accessor
     const std::vector< tk::real >& ord() const noexcept { return m_ordinary; }
 
     //! Central moments accessor
     const std::vector< tk::real >& ctr() const noexcept { return m_central; }
 
+    //! Shifted central moments accessor
+    const std::vector< tk::real >& shifted() const noexcept
+    { return m_shifted; }
+
     //! Ordinary univariate PDFs accessor
     const std::vector< tk::UniPDF >& oupdf() const noexcept { return m_ordupdf; }
 
@@ -141,7 +159,14 @@ class Statistics {
     ///@}
 
     //! Return mean for fluctuation
-    std::size_t mean(const tk::ctr::Term& term) const;
+    static std::size_t mean( const std::vector< tk::ctr::Term >& ordTerm,
+                             const tk::ctr::Term& term );
+
+    //! Sum ordinary moments over a range of particles
+    void sumOrd( std::size_t from, std::size_t till );
+
+    //! Sum ordinary PDFs over a range of particles
+    void sumOrdPDF( std::size_t from, std::size_t till );
 
     //! Particle properties
     const tk::Particles& m_particles;
@@ -165,6 +190,18 @@ class Statistics {
     std::vector< std::vector< const tk::real* > > m_ctr;
     //! Number of central moments
     std::size_t m_ncen;
+
+    //! Shifts, i.e., previous ordinary moments, for shifted central moments
+    std::vector< tk::real > m_shift;
+    //! Shifts about which to compute shifted central moments
+    std::vector< std::vector< const tk::real* > > m_ctrShift;
+    //! \brief Shifted central moments of all nonempty subsets of the terms of
+    //!   all central moments
+    std::vector< tk::real > m_shifted;
+    //! Products of shifted variables of all subsets of terms of a moment
+    std::vector< tk::real > m_subset;
+    //! Sums of moments over a chunk of particles
+    std::vector< tk::real > m_partial;
     ///@}
 
     /** @name Data for univariate probability density function estimation */
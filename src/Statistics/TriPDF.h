@@ -8,9 +8,9 @@
   \brief     Joint trivariate PDF estimator
   \details   Joint trivariate PDF estimator. This class can be used to estimate
     a joint probability density function (PDF) of three scalar variables from an
-    ensemble. The implementation uses the standard container std::unordered_map,
-    which is a hash-based associative container with linear algorithmic
-    complexity for insertion of a new sample.
+    ensemble. The bins are stored in a dense array that grows on demand,
+    falling back to a hash-based associative container only if the sample
+    space extent exceeds a memory budget, see PDFBins.
 */
 // *****************************************************************************
 #ifndef TriPDF_h
@@ -22,6 +22,7 @@
 
 #include "Types.h"
 #include "PUPUtil.h"
+#include "PDFBins.h"
 
 namespace tk {
 
@@ -38,21 +39,14 @@ class TriPDF {
     //! Pair type
     using pair_type = std::pair< const key_type, tk::real >;
 
-    // Hash functor for key_type
-    struct key_hash {
-      std::size_t operator()( const key_type& key ) const {
-        return std::hash< long >()( key[0] ) ^
-               std::hash< long >()( key[1] ) ^
-               std::hash< long >()( key[2] );
-      }
-    };
+    //! Hash functor for key_type
+    using key_hash = PDFBins< dim >::key_hash;
 
-    //! \brief Joint trivariate PDF
-    //! \details The underlying container type is an unordered_map where the key
-    //!   is three bin ids corresponding to the three sample space dimensions,
-    //!   and the mapped value is the sample counter. The hasher functor,
-    //!   defined by key_hash provides an XORed hash of the three bin ids.
-    using map_type = std::unordered_map< key_type, tk::real, key_hash >;
+    //! \brief Joint trivariate PDF map, see map()
+    //! \details The key is three bin ids corresponding to the three sample space
+    //!   dimensions, and the mapped value is the sample counter. The hasher
+    //!   functor, defined by key_hash provides an XORed hash of the bin ids.
+    using map_type = PDFBins< dim >::map_type;
 
     //! Empty constructor for Charm++
     explicit TriPDF() : m_binsize( {{ 0, 0, 0 }} ), m_nsample( 0 ), m_pdf() {}
@@ -72,9 +66,30 @@ class TriPDF {
     //! \param[in] sample Sample to add
     void add( std::array< tk::real, dim > sample ) {
       ++m_nsample;
-      ++m_pdf[ {{ std::lround( sample[0] / m_binsize[0] ),
-                  std::lround( sample[1] / m_binsize[1] ),
-                  std::lround( sample[2] / m_binsize[2] ) }} ];
+      m_pdf.add( {{ std::lround( sample[0] / m_binsize[0] ),
+                   std::lround( sample[1] / m_binsize[1] ),
+                   std::lround( sample[2] / m_binsize[2] ) }} );
+    }
+
+    //! Add multiple samples to trivariate PDF
+    //! \param[in] x Pointer to the first sample in the first dimension
+    //! \param[in] y Pointer to the first sample in the second dimension
+    //! \param[in] z Pointer to the first sample in the third dimension
+    //! \param[in] n Number of samples to add
+    //! \details The bin ids of a batch of samples are computed in a separate
+    //!   loop, without dependencies between the samples, thus it vectorizes.
+    void add( const tk::real* x, const tk::real* y, const tk::real* z, std::size_t n ) {
+      m_nsample += n;
+      std::array< key_type, PDFBatch > k;
+      for (std::size_t b=0; b<n; b+=PDFBatch) {
+        const auto m = std::min( PDFBatch, n-b );
+        for (std::size_t i=0; i<m; ++i) {
+          k[i][0] = std::lround( x[b+i] / m_binsize[0] );
+          k[i][1] = std::lround( y[b+i] / m_binsize[1] );
+          k[i][2] = std::lround( z[b+i] / m_binsize[2] );
+        }
+        for (std::size_t i=0; i<m; ++i) m_pdf.add( k[i] );
+      }
     }
 
     //! Add multiple samples from a PDF
@@ -82,15 +97,23 @@ class TriPDF {
     void addPDF( const TriPDF& p ) {
       m_binsize = p.binsize();
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      m_pdf.merge( p.bins() );
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
-
-    //! Constant accessor to underlying PDF map
-    //! \return Constant reference to underlying map
-    const map_type& map() const noexcept { return m_pdf; }
+    void zero() { m_nsample = 0; m_pdf.zero(); }
+
+    //! Constant accessor to bins
+    //! \return Constant reference to bins
+    const PDFBins< dim >& bins() const noexcept { return m_pdf; }
+
+    //! Construct map of nonempty bins
+    //! \return Map of nonempty bins, bin ids and sample counter
+    map_type map() const {
+      map_type m;
+      m_pdf.each( [&m]( const key_type& k, tk::real c ){ m[k] = c; } );
+      return m;
+    }
 
     //! Constant accessor to bin sizes
     //! \return Constant reference to sample space bin sizes
@@ -102,18 +125,7 @@ class TriPDF {
     //! \return {xmin,xmax,ymin,ymax,zmin,zmax} Minima and maxima of bin the ids
     std::array< long, 2*dim > extents() const {
       Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
-                 []( const pair_type& a, const pair_type& b )
-                 { return a.first[0] < b.first[0]; } );
-      auto y = std::minmax_element( begin(m_pdf), end(m_pdf),
-                 []( const pair_type& a, const pair_type& b )
-                 { return a.first[1] < b.first[1]; } );
-      auto z = std::minmax_element( begin(m_pdf), end(m_pdf),
-                 []( const pair_type& a, const pair_type& b )
-                 { return a.first[2] < b.first[2]; } );
-      return {{ x.first->first[0], x.second->first[0],
-                y.first->first[1], y.second->first[1],
-                z.first->first[2], z.second->first[2] }};
+      return m_pdf.extents();
     }
 
     /** @name Pack/Unpack: Serialize BiPDF object for Charm++ */
@@ -134,7 +146,7 @@ class TriPDF {
   private:
     std::array< tk::real, dim > m_binsize;   //!< Sample space bin sizes
     std::size_t m_nsample;                   //!< Number of samples collected
-    map_type m_pdf;                          //!< Probability density function
+    PDFBins< dim > m_pdf;                    //!< Probability density function
 };
 
 } // tk::
@@ -8,9 +8,9 @@
   \brief     Univariate PDF estimator
   \details   Univariate PDF estimator. This class can be used to estimate a
     probability density function of (PDF) a scalar variable from an ensemble.
-    The implementation uses the standard container std::unordered_map, which is
-    a hash-based associative container with linear algorithmic complexity for
-    insertion of a new sample.
+    The bins are stored in a dense array that grows on demand, falling back to
+    a hash-based associative container only if the sample space extent
+    exceeds a memory budget, see PDFBins.
 */
 // *****************************************************************************
 #ifndef UniPDF_h
@@ -23,6 +23,7 @@
 #include "Types.h"
 #include "Exception.h"
 #include "PUPUtil.h"
+#include "PDFBins.h"
 
 namespace tk {
 
@@ -39,11 +40,11 @@ class UniPDF {
     //! Pair type
     using pair_type = std::pair< const key_type, tk::real >;
 
-    //! \brief Univariate PDF
-    //! \details The underlying container type is an unordered_map where the key
-    //!   is one bin id corresponding to the single sample space dimension, and
-    //!   the mapped value is the sample counter. The hasher functor used here
-    //!   is the default for the key type provided by the standard library.
+    //! \brief Univariate PDF map, see map()
+    //! \details The key is one bin id corresponding to the single sample space
+    //!   dimension, and the mapped value is the sample counter. The hasher
+    //!   functor used here is the default for the key type provided by the
+    //!   standard library.
     using map_type = std::unordered_map< key_type, tk::real >;
 
     //! Empty constructor for Charm++
@@ -63,7 +64,23 @@ class UniPDF {
     void add( tk::real sample ) {
       Assert( m_binsize > 0, "Bin size must be positive" );
       ++m_nsample;
-      ++m_pdf[ std::lround( sample / m_binsize ) ];
+      m_pdf.add( {{ std::lround( sample / m_binsize ) }} );
+    }
+
+    //! Add multiple samples to univariate PDF
+    //! \param[in] sample Pointer to the first sample to insert
+    //! \param[in] n Number of samples to insert
+    //! \details The bin ids of a batch of samples are computed in a separate
+    //!   loop, without dependencies between the samples, thus it vectorizes.
+    void add( const tk::real* sample, std::size_t n ) {
+      Assert( m_binsize > 0, "Bin size must be positive" );
+      m_nsample += n;
+      std::array< long, PDFBatch > k;
+      for (std::size_t b=0; b<n; b+=PDFBatch) {
+        const auto m = std::min( PDFBatch, n-b );
+        for (std::size_t i=0; i<m; ++i) k[i] = std::lround(sample[b+i]/m_binsize);
+        for (std::size_t i=0; i<m; ++i) m_pdf.add( {{ k[i] }} );
+      }
     }
 
     //! Add multiple samples from a PDF
@@ -71,15 +88,24 @@ class UniPDF {
     void addPDF( const UniPDF& p ) {
       m_binsize = p.binsize();
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      m_pdf.merge( p.bins() );
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
-
-    //! Constant accessor to underlying PDF map
-    //! \return Constant reference to underlying map
-    const map_type& map() const noexcept { return m_pdf; }
+    void zero() { m_nsample = 0; m_pdf.zero(); }
+
+    //! Constant accessor to bins
+    //! \return Constant reference to bins
+    const PDFBins< dim >& bins() const noexcept { return m_pdf; }
+
+    //! Construct map of nonempty bins
+    //! \return Map of nonempty bins, bin id and sample counter
+    map_type map() const {
+      map_type m;
+      m_pdf.each( [&m]( const PDFBins< dim >::key_type& k, tk::real c )
+                  { m[ k[0] ] = c; } );
+      return m;
+    }
 
     //! Constant accessor to bin size
     //! \return Sample space bin size
@@ -89,10 +115,7 @@ class UniPDF {
     //! \return {min,max} Minimum and maximum of the bin ids
     std::array< long, 2*dim > extents() const {
       Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
-                 []( const pair_type& a, const pair_type& b )
-                 { return a.first < b.first; } );
-      return {{ x.first->first, x.second->first }};
+      return m_pdf.extents();
     }
 
     /** @name Pack/Unpack: Serialize UniPDF object for Charm++ */
@@ -113,7 +136,7 @@ class UniPDF {
   private:
     tk::real m_binsize;         //!< Sample space bin size
     std::size_t m_nsample;      //!< Number of samples collected
-    map_type m_pdf;             //!< Probability density function
+    PDFBins< dim > m_pdf;       //!< Probability density function
 };
 
 //! Output univariate PDF to output stream
@@ -124,8 +147,9 @@ class UniPDF {
 static inline
 std::ostream& operator<< ( std::ostream& os, const tk::UniPDF& p ) {
   os << p.binsize() << ", " << p.nsample() << ": ";
+  const auto m = p.map();
   std::map< typename tk::UniPDF::key_type, tk::real >
-    sorted( p.map().begin(), p.map().end() );
+    sorted( m.begin(), m.end() );
   for (const auto& b : sorted) os << '(' << b.first << ',' << b.second << ") ";
   return os;
 }
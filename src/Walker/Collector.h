@@ -14,9 +14,13 @@
 #ifndef Collector_h
 #define Collector_h
 
+#include <map>
+#include <vector>
 #include <cstddef>
 
 #include "Types.h"
+#include "RNG.h"
+#include "Options/RNG.h"
 #include "PDFReducer.h"
 #include "Make_unique.h"
 #include "Distributor.h"
@@ -25,6 +29,7 @@
 namespace walker {
 
 extern ctr::InputDeck g_inputdeck;
+extern std::map< tk::ctr::RawRNGType, tk::RNG > g_rng;
 extern CkReduction::reducerType PDFMerger;
 
 #if defined(__clang__)
@@ -51,6 +56,7 @@ class Collector : public CBase_Collector {
       m_ncen( 0 ),
       m_ordinary( g_inputdeck.momentNames( tk::ctr::ordinary ).size(), 0.0 ),
       m_central( g_inputdeck.momentNames( tk::ctr::central ).size(), 0.0 ),
+      m_shifted(),
       m_ordupdf(
         tk::ctr::numPDF< 1 >( g_inputdeck.get< tag::discr, tag::binsize >(),
                               g_inputdeck.get< tag::pdf >(),
@@ -77,6 +83,10 @@ class Collector : public CBase_Collector {
                               tk::ctr::Moment::CENTRAL ) )
     {}
 
+    //! Migrate constructor: returning from a checkpoint
+    // cppcheck-suppress uninitMemberVar
+    explicit Collector( CkMigrateMessage* m ) : CBase_Collector( m ) {}
+
     //! \brief Configure Charm++ reduction types for collecting PDFs
     //! \details Since this is a [nodeinit] routine, see collector.ci, the
     //!   Charm++ runtime system executes the routine exactly once on every
@@ -96,7 +106,8 @@ class Collector : public CBase_Collector {
     void chareOrd( const std::vector< tk::real >& ord,
                    const std::vector< tk::UniPDF >& updf,
                    const std::vector< tk::BiPDF >& bpdf,
-                   const std::vector< tk::TriPDF >& tpdf );
+                   const std::vector< tk::TriPDF >& tpdf,
+                   const std::vector< tk::real >& shifted );
 
     //! Chares contribute central moments and central PDFs
     void chareCen( const std::vector< tk::real >& cen,
@@ -104,6 +115,46 @@ class Collector : public CBase_Collector {
                    const std::vector< tk::BiPDF >& bpdf,
                    const std::vector< tk::TriPDF >& tpdf );
 
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \details Also packs and unpacks the state of the random number streams
+    //!   of this PE, which advance as the integrators draw from them, so that
+    //!   after a restart the streams continue where they were at the
+    //!   checkpoint. The streams are re-created from their seeds when the
+    //!   global-scope generators are unpacked, before the groups, see the
+    //!   Pack/Unpack of g_rng in Main/Walker.C.
+    void pup( PUP::er &p ) override {
+      std::map< tk::ctr::RawRNGType, std::vector< char > > rngstate;
+      if (!p.isUnpacking())
+        for (const auto& r : g_rng)
+          rngstate[ r.first ] = r.second.state( CkMyPe() );
+      p | rngstate;
+      if (p.isUnpacking())
+        for (const auto& r : rngstate)
+          g_rng.at( r.first ).state( CkMyPe(), r.second );
+      p | m_hostproxy;
+      p | m_nchare;
+      p | m_nord;
+      p | m_ncen;
+      p | m_ordinary;
+      p | m_central;
+      p | m_shifted;
+      p | m_ordupdf;
+      p | m_ordbpdf;
+      p | m_ordtpdf;
+      p | m_cenupdf;
+      p | m_cenbpdf;
+      p | m_centpdf;
+      p | m_extra;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c Collector object reference
+    friend void operator|( PUP::er& p, Collector& c ) { c.pup(p); }
+    //@}
+
   private:
     CProxy_Distributor m_hostproxy;             //!< Host proxy    
     std::size_t m_nchare;  //!< Number of chares contributing to my PE
@@ -111,6 +162,7 @@ class Collector : public CBase_Collector {
     std::size_t m_ncen;    //!< Number of chares contributed central moments
     std::vector< tk::real > m_ordinary;         //!< Ordinary moments
     std::vector< tk::real > m_central;          //!< Central moments
+    std::vector< tk::real > m_shifted;          //!< Shifted central moments
     std::vector< tk::UniPDF > m_ordupdf;        //!< Ordinary univariate PDFs
     std::vector< tk::BiPDF > m_ordbpdf;         //!< Ordinary bivariate PDFs
     std::vector< tk::TriPDF > m_ordtpdf;        //!< Ordinary trivariate PDFs
@@ -70,6 +70,16 @@ class Distributor : public CBase_Distributor {
     //! Constructor
     explicit Distributor( const ctr::CmdLine& cmdline );
 
+    #if defined(__clang__)
+      #pragma clang diagnostic push
+      #pragma clang diagnostic ignored "-Wundefined-func-template"
+    #endif
+    //! Migrate constructor: returning from a checkpoint
+    explicit Distributor( CkMigrateMessage* m );
+    #if defined(__clang__)
+      #pragma clang diagnostic pop
+    #endif
+
     //! \brief Reduction target indicating that all Integrator chares have
     //!   registered with the statistics merger (collector)
     //! \details This function is a Charm++ reduction target that is called when
@@ -78,7 +88,7 @@ class Distributor : public CBase_Distributor {
     //!   broadcast to all Itegrator chares to continue with their setup.
     void registered() { m_intproxy.setup( m_dt, m_t, m_it, m_moments ); }
 
-    //! Estimate ordinary moments
+    //! Estimate ordinary moments (and central moments if fused)
     void estimateOrd( tk::real* ord, int n );
 
     //! Estimate central moments
@@ -93,6 +103,42 @@ class Distributor : public CBase_Distributor {
     //! Charm++ reduction target enabling shortcutting sync points if no stats
     void nostat();
 
+    //! Continue time stepping after a checkpoint or a restart
+    void resume();
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \note This is a Charm++ chare, pup() is thus virtual
+    void pup( PUP::er &p ) override {
+      p | m_output;
+      p | m_it;
+      p | m_npar;
+      p | m_t;
+      p | m_dt;
+      p | m_intproxy;
+      p | m_timer;
+      p | m_nameOrdinary;
+      p | m_nameCentral;
+      p | m_ordinary;
+      p | m_central;
+      p | m_ordupdf;
+      p | m_ordbpdf;
+      p | m_ordtpdf;
+      p | m_cenupdf;
+      p | m_cenbpdf;
+      p | m_centpdf;
+      p | m_tables;
+      p | m_moments;
+      p | m_fused;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] d Distributor object reference
+    friend void operator|( PUP::er& p, Distributor& d ) { d.pup(p); }
+    //@}
+
   private:
     //! Print information at startup
     void info( uint64_t chunksize, std::size_t nchare );
@@ -144,6 +190,9 @@ class Distributor : public CBase_Distributor {
     //! Evaluate time step, compute new time step size
     void evaluateTime();
 
+    //! Continue with the next time step
+    void next();
+
     //! Pretty printer
     WalkerPrint m_print;
     //! Output indicators
@@ -155,6 +204,13 @@ class Distributor : public CBase_Distributor {
     tk::real m_dt;                              //!< Physical time step size
     CProxy_Integrator m_intproxy;               //!< Integrator array proxy
     std::vector< tk::Timer > m_timer;           //!< Timers
+    tk::Timer m_steptimer;      //!< Timer measuring steps between checkpoints
+    tk::Timer m_chktimer;       //!< Timer measuring checkpoint writes
+    tk::real m_steptime;        //!< Average wall-clock time of a time step
+    bool m_restarted;           //!< True if restarted from a checkpoint
+    //! \brief True if particles are advanced and statistics are accumulated
+    //!   in a single sweep in this time step
+    bool m_fused;
     std::vector< std::string > m_nameOrdinary;  //!< Ordinary moment names
     std::vector< std::string > m_nameCentral;   //!< Central moment names
     std::vector< tk::real > m_ordinary;         //!< Ordinary moments
@@ -20,8 +20,10 @@
 #include <vector>
 #include <map>
 #include <cstdint>
+#include <memory>
 
 #include "Types.h"
+#include "Make_unique.h"
 #include "Tags.h"
 #include "StatCtr.h"
 #include "DiffEq.h"
@@ -53,12 +55,7 @@ class Integrator : public CBase_Integrator {
     //! Migrate constructor
     // cppcheck-suppress uninitMemberVar
     explicit Integrator( CkMigrateMessage* ) :
-      m_particles( 0, g_inputdeck.get< tag::component >().nprop() ),
-      m_stat( m_particles,
-                g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
-                g_inputdeck.get< tag::stat >(),
-                g_inputdeck.get< tag::pdf >(),
-                g_inputdeck.get< tag::discr, tag::binsize >() ) {}
+      m_particles(), m_stat(), m_work() {}
 
     //! Perform setup: set initial conditions and advance a time step
     void setup( tk::real dt,
@@ -73,7 +70,8 @@ class Integrator : public CBase_Integrator {
     void advance( tk::real dt,
                   tk::real t,
                   uint64_t it,
-                  const std::map< tk::ctr::Product, tk::real >& moments );
+                  const std::map< tk::ctr::Product, tk::real >& moments,
+                  bool fused );
 
     // Accumulate sums for ordinary moments and ordinary PDFs
     void accumulateOrd( uint64_t it, tk::real t, tk::real dt );
@@ -84,11 +82,42 @@ class Integrator : public CBase_Integrator {
                         tk::real dt,
                         const std::vector< tk::real >& ord );
 
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \details The statistics estimator refers to the particle properties,
+    //!   thus it is not migrated but re-created once the particle properties
+    //!   have been unpacked.
+    void pup( PUP::er &p ) override {
+      p | m_hostproxy;
+      p | m_collproxy;
+      p | m_particles;
+      if (p.isUnpacking()) m_stat = statistics();
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] i Integrator object reference
+    friend void operator|( PUP::er& p, Integrator& i ) { i.pup(p); }
+    //@}
+
   private:
     CProxy_Distributor m_hostproxy;     //!< Host proxy
     CProxy_Collector m_collproxy;       //!< Collector proxy
     tk::Particles m_particles;          //!< Particle properties
-    tk::Statistics m_stat;              //!< Statistics
+    std::unique_ptr< tk::Statistics > m_stat; //!< Statistics estimator
+    //! Scratch buffer reused by the equations to advance particles
+    std::vector< tk::real > m_work;
+
+    //! Create statistics estimator for the particles of this integrator
+    std::unique_ptr< tk::Statistics > statistics() const;
+
+    //! \brief Advance all particles and accumulate statistics a chunk of
+    //!   particles at a time
+    void advanceFused( tk::real dt,
+                       tk::real t,
+                       uint64_t it,
+                       const std::map< tk::ctr::Product, tk::real >& moments );
 };
 
 #if defined(__clang__)
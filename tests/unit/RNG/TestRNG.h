@@ -10,6 +10,7 @@
 */
 // *****************************************************************************
 
+#include <vector>
 #include <functional>
 
 #include "NoWarning/value_factory.h"
@@ -264,6 +265,23 @@ struct RNG_common {
     test_gaussian( v );        // test that the newly moved RNG works
   }
 
+  //! Test that setting the state of a stream replays its sequence
+  //! \param[in] r RNG to test
+  template< class rng >
+  static void test_state( const rng& r ) {
+    const std::size_t num = 1000;
+    std::vector< double > a( num ), b( num );
+    for (int tid=0; tid<static_cast<int>(r.nthreads()); ++tid) {
+      r.uniform( tid, num, a.data() );     // advance stream from its start
+      auto s = r.state( tid );
+      r.uniform( tid, num, a.data() );
+      r.uniform( tid, num, b.data() );     // advance stream past saved state
+      r.state( tid, s );
+      r.uniform( tid, num, b.data() );
+      ensure( "numbers after restoring stream state differ", a == b );
+    }
+  }
+
   // Test the first four moments of random numbers passed in
   //! \param[in] numbers Random numbers to test
   //! \param[in] correct_mean Baseline mean to compare to